@@ -16,6 +16,15 @@ Key Features:
 3. Convert an Ethiopian date to the equivalent Gregorian date.
 4. Display a standard Gregorian calendar for any given Gregorian year.
 5. Identify and display major Ethiopian holidays based on the date.
+6. Batch-convert dates non-interactively (--g2e / --e2g), one date per line.
+7. Render a range of Ethiopian or Gregorian years in parallel (--ethiopian-years / --gregorian-years).
+8. Benchmark the calendar core (a separate program, ethiopian_calendar_bench.cpp).
+9. Serve conversions, holidays and calendars to local clients over a socket (--serve).
+10. Verify every day of a wide range against a slow reference calendar (--verify).
+11. Report operation counts and latency histograms in Prometheus or JSON form (--stats).
+
+The calendar logic itself lives in the reentrant, header-only library ethiopian_calendar.h;
+this file is the command-line front end built on top of it.
 
 This program enhances understanding of date handling, calendar logic, array usage, leap year
 calculations, and user input/output operations in C++.
@@ -25,263 +34,1670 @@ calculations, and user input/output operations in C++.
 
 
 #include <iostream>
-#include <iomanip>
-#include <ctime> // for time and date calculations
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <array>
+#include <deque>
+#include <list>
+#include <unordered_map>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include <bit>
+#include <cerrno>
+#include <csignal>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include "ethiopian_calendar.h" // calendar core: conversions, holidays, rendering
 using namespace std;
+using namespace ethiocal;
+// The server's wire format reuses the core's digit readers and writers
+using ethiocal::detail::appendInt;
+using ethiocal::detail::parseDigits;
+using ethiocal::detail::parseYear;
+
+// ---------------------------------------------------------------------------------------
+// Instrumentation
+// Per-operation counters and HDR-style latency histograms for conversions, holiday lookups
+// and every render path, exported as Prometheus text or JSON ("--stats", or STATS on the
+// server). Build with -DETHIOCAL_STATS=0 to compile all of it out: the timers then become
+// empty objects and the recording calls disappear.
+//
+// Each timed call records one latency sample and adds the number of items it handled to
+// the operation counter, so a batch of 1000 conversions is one sample and 1000 operations
+// (timing every 5 ns conversion separately would cost more than the conversion itself).
+// ---------------------------------------------------------------------------------------
+
+#ifndef ETHIOCAL_STATS
+#define ETHIOCAL_STATS 1
+#endif
 
-// Ethiopian calendar month names
-string months[13] = {
-    "Meskerem", "Tikimt", "Hidar", "Tahisas", "Tir", "Yekatit",
-    "Megabit", "Miyazia", "Ginbot", "Sene", "Hamle", "Nehase", "Pagume"
+enum class StatOp : unsigned char {
+    GregorianToEthiopian,
+    EthiopianToGregorian,
+    HolidayLookup,
+    RenderEthiopianYear,
+    RenderGregorianYear,
+    RenderEthiopianMonth,
+    RenderGregorianMonth,
+    Count
 };
 
-// Weekday names starting from Monday
-string weekdays[7] = {"Mon", "Tue", "Wed", "Thu", "Fri", "Sat", "Sun"};
+constexpr const char* STAT_OP_NAMES[] = {
+    "gregorian_to_ethiopian", "ethiopian_to_gregorian", "holiday_lookup", "render_ethiopian_year",
+    "render_gregorian_year", "render_ethiopian_month", "render_gregorian_month"
+};
+static_assert(size(STAT_OP_NAMES) == static_cast<size_t>(StatOp::Count), "one name per operation");
 
-// Function to check if an Ethiopian year is a leap year
-bool isLeapYear(int year) {
-    // In the Ethiopian calendar, a year is a leap year if it leaves remainder 3 when divided by 4
-    return year % 4 == 3;
-}
+// Latencies in nanoseconds, bucketed log-linearly: 8 sub-buckets per power of two, so every
+// bucket is within 12.5% of its values, from 1 ns up to about two hours
+class LatencyHistogram {
+public:
+    static constexpr int SUB_BITS = 3;
+    static constexpr int SUB_BUCKETS = 1 << SUB_BITS;
+    static constexpr int MAGNITUDES = 40;
+    static constexpr int BUCKETS = (MAGNITUDES + 1) * SUB_BUCKETS;
 
-// Calculate the Ethiopian "Amete Alem" (year since creation of the world)
-int computeAmeteAlem(int year) {
-    return 5500 + year;
-}
+    static int bucketOf(uint64_t ns) {
+        if (ns < SUB_BUCKETS) return static_cast<int>(ns);
+        int magnitude = 63 - countl_zero(ns) - SUB_BITS + 1; // >= 1
+        if (magnitude > MAGNITUDES) return BUCKETS - 1;
+        return magnitude * SUB_BUCKETS + static_cast<int>((ns >> (magnitude - 1)) & (SUB_BUCKETS - 1));
+    }
+
+    // Largest value that lands in `bucket`
+    static uint64_t bucketUpperBound(int bucket) {
+        int magnitude = bucket / SUB_BUCKETS, sub = bucket % SUB_BUCKETS;
+        if (magnitude == 0) return static_cast<uint64_t>(sub);
+        return ((static_cast<uint64_t>(SUB_BUCKETS + sub) + 1) << (magnitude - 1)) - 1;
+    }
+
+    void record(uint64_t ns) {
+        counts[bucketOf(ns)].fetch_add(1, memory_order_relaxed);
+        total.fetch_add(1, memory_order_relaxed);
+        sum.fetch_add(ns, memory_order_relaxed);
+        uint64_t seen = maximum.load(memory_order_relaxed);
+        while (ns > seen && !maximum.compare_exchange_weak(seen, ns, memory_order_relaxed)) {}
+    }
+
+    uint64_t samples() const {
+        return total.load(memory_order_relaxed);
+    }
+
+    uint64_t sumNs() const {
+        return sum.load(memory_order_relaxed);
+    }
+
+    uint64_t maxNs() const {
+        return maximum.load(memory_order_relaxed);
+    }
+
+    uint64_t bucketCount(int bucket) const {
+        return counts[bucket].load(memory_order_relaxed);
+    }
+
+    // Upper bound of the bucket holding the q-th quantile (0 when empty)
+    uint64_t quantileNs(double q) const {
+        uint64_t n = samples();
+        if (n == 0) return 0;
+        uint64_t rank = static_cast<uint64_t>(q * static_cast<double>(n - 1)) + 1, seen = 0;
+        for (int b = 0; b < BUCKETS; ++b) {
+            seen += bucketCount(b);
+            if (seen >= rank) return min(bucketUpperBound(b), maxNs());
+        }
+        return maxNs();
+    }
 
-// Calculate Metene Rabiet (used to determine starting weekday)
-int computeMeteneRabiet(int amete_alem) {
-    return amete_alem / 4;
+private:
+    atomic<uint64_t> counts[BUCKETS] = {};
+    atomic<uint64_t> total{0}, sum{0}, maximum{0};
+};
+
+struct OperationStats {
+    atomic<uint64_t> operations{0};
+    LatencyHistogram latency;
+};
+
+OperationStats operationStats[static_cast<size_t>(StatOp::Count)];
+
+#if ETHIOCAL_STATS
+
+// Times its own lifetime and records it against `op`, with `items` operations
+class OperationTimer {
+public:
+    explicit OperationTimer(StatOp timedOp, uint64_t count = 1) : op(timedOp), items(count), start(chrono::steady_clock::now()) {}
+
+    ~OperationTimer() {
+        uint64_t ns = static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count());
+        OperationStats& stats = operationStats[static_cast<size_t>(op)];
+        stats.operations.fetch_add(items, memory_order_relaxed);
+        stats.latency.record(ns);
+    }
+
+    // For batches whose size is only known at the end
+    void setItems(uint64_t count) {
+        items = count;
+    }
+
+private:
+    StatOp op;
+    uint64_t items;
+    chrono::steady_clock::time_point start;
+};
+
+#else
+
+class OperationTimer {
+public:
+    explicit OperationTimer(StatOp, uint64_t = 1) {}
+    void setItems(uint64_t) {}
+};
+
+#endif
+
+// Prometheus text exposition: a counter and a cumulative latency histogram per operation
+string formatStatsPrometheus() {
+    string out;
+    char line[256];
+    out += "# HELP ethiocal_operations_total Dates converted, holidays looked up and calendars rendered.\n"
+           "# TYPE ethiocal_operations_total counter\n";
+    for (size_t i = 0; i < static_cast<size_t>(StatOp::Count); ++i) {
+        snprintf(line, sizeof(line), "ethiocal_operations_total{op=\"%s\"} %llu\n", STAT_OP_NAMES[i],
+                 static_cast<unsigned long long>(operationStats[i].operations.load(memory_order_relaxed)));
+        out += line;
+    }
+
+    // Bucket edges every power of four from 16 ns to about 17 s; HDR buckets never straddle them
+    out += "# HELP ethiocal_call_latency_seconds Latency of timed calls (a batch is one call).\n"
+           "# TYPE ethiocal_call_latency_seconds histogram\n";
+    for (size_t i = 0; i < static_cast<size_t>(StatOp::Count); ++i) {
+        const LatencyHistogram& h = operationStats[i].latency;
+        uint64_t cumulative = 0;
+        int bucket = 0;
+        for (uint64_t edge = 16; edge <= (uint64_t(1) << 34); edge <<= 2) {
+            while (bucket < LatencyHistogram::BUCKETS && LatencyHistogram::bucketUpperBound(bucket) < edge) {
+                cumulative += h.bucketCount(bucket++);
+            }
+            snprintf(line, sizeof(line), "ethiocal_call_latency_seconds_bucket{op=\"%s\",le=\"%g\"} %llu\n", STAT_OP_NAMES[i],
+                     static_cast<double>(edge) * 1e-9, static_cast<unsigned long long>(cumulative));
+            out += line;
+        }
+        snprintf(line, sizeof(line),
+                 "ethiocal_call_latency_seconds_bucket{op=\"%s\",le=\"+Inf\"} %llu\n"
+                 "ethiocal_call_latency_seconds_sum{op=\"%s\"} %.9f\n"
+                 "ethiocal_call_latency_seconds_count{op=\"%s\"} %llu\n",
+                 STAT_OP_NAMES[i], static_cast<unsigned long long>(h.samples()), STAT_OP_NAMES[i], h.sumNs() * 1e-9,
+                 STAT_OP_NAMES[i], static_cast<unsigned long long>(h.samples()));
+        out += line;
+    }
+    return out;
 }
 
-// Determine the Evangelist name for the year
-string getEvangelist(int amete_alem) {
-    switch (amete_alem % 4) {
-        case 1: return "Mathewos";
-        case 2: return "Markos";
-        case 3: return "Lukas";
-        default: return "Yohannes";
+string formatStatsJson() {
+    string out = "{\n  \"enabled\": ";
+    out += ETHIOCAL_STATS ? "true" : "false";
+    out += ",\n  \"operations\": [\n";
+    char line[512];
+    for (size_t i = 0; i < static_cast<size_t>(StatOp::Count); ++i) {
+        const LatencyHistogram& h = operationStats[i].latency;
+        snprintf(line, sizeof(line),
+                 "    {\"name\": \"%s\", \"operations\": %llu, \"calls\": %llu, \"sum_ns\": %llu, "
+                 "\"p50_ns\": %llu, \"p90_ns\": %llu, \"p99_ns\": %llu, \"max_ns\": %llu}%s\n",
+                 STAT_OP_NAMES[i], static_cast<unsigned long long>(operationStats[i].operations.load(memory_order_relaxed)),
+                 static_cast<unsigned long long>(h.samples()), static_cast<unsigned long long>(h.sumNs()),
+                 static_cast<unsigned long long>(h.quantileNs(0.5)), static_cast<unsigned long long>(h.quantileNs(0.9)),
+                 static_cast<unsigned long long>(h.quantileNs(0.99)), static_cast<unsigned long long>(h.maxNs()),
+                 i + 1 < static_cast<size_t>(StatOp::Count) ? "," : "");
+        out += line;
     }
+    out += "  ]\n}\n";
+    return out;
 }
 
-// Find the start day of the Ethiopian year (1 Meskerem)
-// Returns day index: 0 = Monday, ..., 6 = Sunday
-int computeNewYearStartDay(int year) {
-    int amete_alem = computeAmeteAlem(year);
-    int metene_rabiet = computeMeteneRabiet(amete_alem);
-    return (amete_alem + metene_rabiet) % 7;
+// Set by "--stats[=json]": statistics are written to stderr when the program exits
+enum class StatsExport { None, Prometheus, Json };
+StatsExport statsExportAtExit = StatsExport::None;
+
+void writeStatsAtExit() {
+    if (statsExportAtExit == StatsExport::None) return;
+    string text = statsExportAtExit == StatsExport::Json ? formatStatsJson() : formatStatsPrometheus();
+    fwrite(text.data(), 1, text.size(), stderr);
 }
 
-// Get Ethiopian holidays based on fixed dates
-string getEthiopianHoliday(int year, int month, int day) {
-    bool isLeap = isLeapYear(year);
+// ---------------------------------------------------------------------------------------
+// Rendered calendar cache
+// Portals ask for the same few years over and over, so finished renders are kept in a
+// byte-bounded LRU cache keyed by (calendar, year, format). A repeat request is a lookup
+// plus a copy of the cached text; the server even writes the cached string directly.
+// ---------------------------------------------------------------------------------------
 
-    if (month == 1 && day == 1) return "Enkutatash (New Year)";
-    if (month == 1 && day == 17) return "Meskel";
-    if (month == 4 && ((!isLeap && day == 29) || (isLeap && day == 28))) return "Gena (Christmas)";
-    if (month == 5 && day == 11) return "Timket (Epiphany)";
-    if (month == 6 && day == 23) return "Adwa (Adwa Victory Day)";
-    if (month == 8 && day == 23) return "Ye labaderoch Ken (Labour Day)";
-    if (month == 8 && day == 27) return "Ye Arbegnoch Ken (Patriots' Victory Day)";
+enum class CalendarKind : unsigned char { Ethiopian, Gregorian };
 
-    return "";
-}
+// What was rendered: the whole year, or a single month of it
+enum class RenderFormat : unsigned char { Year, Month };
 
-// Print a calendar grid for a given Ethiopian month
-void printMonthGrid(string monthName, int startDay, int numDays, int year, int monthIndex) {
-    cout << "\n" << monthName << " " << year << "\n";
-    cout << "Mon Tue Wed Thu Fri Sat Sun\n";
+struct RenderKey {
+    CalendarKind calendar;
+    RenderFormat format;
+    int year;
+    int month; // 0 for RenderFormat::Year
 
-    int day = 1, weekDay = 0;
-    bool printedHolidayInMonth = false;
+    bool operator==(const RenderKey&) const = default;
+};
 
-    // Print spaces before the first day of the month
-    while (weekDay < startDay) {
-        cout << "    ";
-        weekDay++;
+struct RenderKeyHash {
+    size_t operator()(const RenderKey& key) const {
+        uint64_t packed = (static_cast<uint64_t>(static_cast<uint32_t>(key.year)) << 32) |
+                          (static_cast<uint64_t>(key.month) << 16) |
+                          (static_cast<uint64_t>(key.format) << 8) | static_cast<uint64_t>(key.calendar);
+        return hash<uint64_t>()(packed);
     }
+};
 
-    // Print each day, marking holidays with '*'
-    while (day <= numDays) {
-        string holiday = getEthiopianHoliday(year, monthIndex, day);
-        if (!holiday.empty()) {
-            cout << setw(2) << day << "* ";
-            printedHolidayInMonth = true;
-        } else {
-            cout << setw(3) << day << " ";
-        }
+struct RenderCacheStats {
+    uint64_t hits, misses, evictions;
+    size_t entries, bytes, byteLimit;
+};
 
-        weekDay++;
-        if (weekDay == 7) {
-            cout << endl;
-            weekDay = 0;
-        }
-        day++;
+// Render `key` into `out` (cleared first)
+void renderCalendar(RenderBuffer& out, const RenderKey& key) {
+    static constexpr StatOp OPS[2][2] = {{StatOp::RenderEthiopianYear, StatOp::RenderEthiopianMonth},
+                                         {StatOp::RenderGregorianYear, StatOp::RenderGregorianMonth}};
+    OperationTimer timer(OPS[static_cast<int>(key.calendar)][static_cast<int>(key.format)]);
+    out.clear();
+    if (key.calendar == CalendarKind::Ethiopian) {
+        if (key.format == RenderFormat::Year) renderEthiopianYear(out, key.year);
+        else renderEthiopianMonth(out, key.year, key.month);
+    } else {
+        if (key.format == RenderFormat::Year) renderGregorianYear(out, key.year);
+        else renderGregorianMonth(out, key.year, key.month);
     }
-    cout << endl;
+}
+
+// Thread-safe LRU of rendered text. Entries are shared and immutable, so a caller can keep
+// using one after it has been evicted. Rendering on a miss happens outside the lock.
+class RenderCache {
+public:
+    explicit RenderCache(size_t limit) : byteLimit(limit) {}
 
-    // If there were holidays, list them below the calendar
-    if (printedHolidayInMonth) {
-        cout << "Holidays this month:\n";
-        for (int d = 1; d <= numDays; d++) {
-            string holiday = getEthiopianHoliday(year, monthIndex, d);
-            if (!holiday.empty()) {
-                cout << d << " - " << holiday << endl;
+    shared_ptr<const string> get(const RenderKey& key) {
+        {
+            lock_guard<mutex> guard(lock);
+            auto found = index.find(key);
+            if (found != index.end()) {
+                ++hits;
+                entries.splice(entries.begin(), entries, found->second);
+                return found->second->text;
             }
+            ++misses;
         }
+
+        thread_local RenderBuffer buffer;
+        renderCalendar(buffer, key);
+        auto text = make_shared<const string>(buffer.view());
+        insert(key, text);
+        return text;
+    }
+
+    RenderCacheStats stats() {
+        lock_guard<mutex> guard(lock);
+        return RenderCacheStats{hits, misses, evictions, entries.size(), bytes, byteLimit};
     }
+
+private:
+    struct Entry {
+        RenderKey key;
+        shared_ptr<const string> text;
+    };
+
+    // Rough bookkeeping cost of one entry (list node, hash node, string header)
+    static constexpr size_t ENTRY_OVERHEAD = 128;
+
+    static size_t entryBytes(const string& text) {
+        return text.size() + ENTRY_OVERHEAD;
+    }
+
+    void insert(const RenderKey& key, const shared_ptr<const string>& text) {
+        size_t size = entryBytes(*text);
+        if (size > byteLimit) return; // would evict everything and still not fit
+
+        lock_guard<mutex> guard(lock);
+        if (index.count(key) != 0) return; // another thread rendered it meanwhile
+        while (bytes + size > byteLimit) {
+            const Entry& oldest = entries.back();
+            bytes -= entryBytes(*oldest.text);
+            index.erase(oldest.key);
+            entries.pop_back();
+            ++evictions;
+        }
+        entries.push_front(Entry{key, text});
+        index.emplace(key, entries.begin());
+        bytes += size;
+    }
+
+    mutex lock;
+    list<Entry> entries; // most recently used first
+    unordered_map<RenderKey, list<Entry>::iterator, RenderKeyHash> index;
+    size_t bytes = 0;
+    size_t byteLimit;
+    uint64_t hits = 0, misses = 0, evictions = 0;
+};
+
+const size_t DEFAULT_RENDER_CACHE_BYTES = 64 << 20;
+
+size_t renderCacheByteLimit = DEFAULT_RENDER_CACHE_BYTES;
+bool renderCacheCreated = false;
+
+// Shared by the interactive menu and the server; created with the configured limit on first use
+RenderCache& renderCache() {
+    static RenderCache cache((renderCacheCreated = true, renderCacheByteLimit));
+    return cache;
+}
+
+// Set the byte limit of the shared cache from main(), before any thread uses it. Once the
+// cache exists its size is fixed, so asking for a different one then returns false.
+bool configureRenderCache(size_t byteLimit) {
+    if (renderCacheCreated) return byteLimit == renderCacheByteLimit;
+    renderCacheByteLimit = byteLimit;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------
+// Console output
+// Thin wrappers that print the library's results for the interactive menu.
+// ---------------------------------------------------------------------------------------
+
+// Write cached text with one call and flush it
+void writeRenderedText(const string& text, FILE* out) {
+    fwrite(text.data(), 1, text.size(), out);
+    fflush(out);
 }
 
 // Display the full Ethiopian calendar for a given year
 void displayFullEthiopianCalendar(int year) {
-    int amete_alem = computeAmeteAlem(year);
-    bool leap = isLeapYear(year);
-    int startDay = computeNewYearStartDay(year); // Starting weekday for Meskerem
-    string evangelist = getEvangelist(amete_alem);
-
-    cout << "\nYear: " << year << endl;
-    cout << "Amete Alem: " << amete_alem << endl;
-    cout << "Evangelist: " << evangelist << endl;
-    cout << "First day of Meskerem: " << weekdays[startDay] << endl;
+    writeRenderedText(*renderCache().get(RenderKey{CalendarKind::Ethiopian, RenderFormat::Year, year, 0}), stdout);
+}
 
-    // Loop through all 13 months
-    for (int i = 0; i < 13; ++i) {
-        int daysInMonth = (i == 12) ? (leap ? 6 : 5) : 30;
-        printMonthGrid(months[i], startDay, daysInMonth, year, i + 1);
-        startDay = (startDay + daysInMonth) % 7;
-    }
+// Print a converted pair of dates, the input calendar first
+void printConvertedDates(const GregorianDate& g, const EthiopianDate& e, bool gregorianFirst) {
+    static constexpr DatePattern GREGORIAN_LINE("Gregorian Date: %Y-%m-%d (%a, %B %-d)\n");
+    static constexpr DatePattern ETHIOPIAN_LINE("Ethiopian Date: %Y-%m-%d (%a, %B %-d, %-Y %E)\n");
+    char text[GREGORIAN_LINE.maxLength() + ETHIOPIAN_LINE.maxLength()];
+    char* end = text;
+    if (gregorianFirst) end = ETHIOPIAN_LINE.format(GREGORIAN_LINE.format(end, g), e);
+    else end = GREGORIAN_LINE.format(ETHIOPIAN_LINE.format(end, e), g);
+    cout << string_view(text, end - text) << flush;
 }
 
 // Convert Gregorian date to Ethiopian date
 void convertGregorianToEthiopian(int gYear, int gMonth, int gDay) {
-    struct tm gDate = {0}, newYearDate = {0};
-    gDate.tm_year = gYear - 1900;
-    gDate.tm_mon = gMonth - 1;
-    gDate.tm_mday = gDay;
-
     // Validate the Gregorian date
-    if (mktime(&gDate) == -1) {
+    if (!isValidGregorianDate(gYear, gMonth, gDay)) {
         cout << "Invalid Gregorian date.\n";
         return;
     }
 
-    // Determine New Year day in Gregorian calendar
-    int newYearDay = 11;
-    bool isGregorianLeap = ((gYear % 4 == 0 && gYear % 100 != 0) || (gYear % 400 == 0));
-    if (isGregorianLeap) newYearDay = 12;
+    EthiopianDate e;
+    {
+        OperationTimer timer(StatOp::GregorianToEthiopian);
+        e = jdnToEthiopian(gregorianToJdn(gYear, gMonth, gDay));
+    }
+
+    // Display result
+    printConvertedDates(GregorianDate{gYear, gMonth, gDay}, e, true);
+}
+
+// Convert Ethiopian date to Gregorian date
+void convertEthiopianToGregorian(int eYear, int eMonth, int eDay) {
+    // Validate Ethiopian date
+    if (!isValidEthiopianDate(eYear, eMonth, eDay)) {
+        cout << "Invalid Ethiopian date.\n";
+        return;
+    }
+
+    GregorianDate g;
+    {
+        OperationTimer timer(StatOp::EthiopianToGregorian);
+        g = jdnToGregorian(ethiopianToJdn(eYear, eMonth, eDay));
+    }
+
+    printConvertedDates(g, EthiopianDate{eYear, eMonth, eDay}, false);
+}
+
+// Display Gregorian calendar for the whole year
+void displayGregorianCalendar(int year) {
+    writeRenderedText(*renderCache().get(RenderKey{CalendarKind::Gregorian, RenderFormat::Year, year, 0}), stdout);
+}
+
+// ---------------------------------------------------------------------------------------
+// Batch (non-interactive) conversion
+// Reads one date per line ("YYYY MM DD", "YYYY-MM-DD", ...) and writes one converted date
+// per line with no prompt text. Invalid lines produce "invalid" so output stays aligned.
+// ---------------------------------------------------------------------------------------
+
+const size_t BATCH_BUFFER_SIZE = 1 << 20;
+// Longest result for one line: an ISO date or "invalid", plus the newline
+constexpr size_t BATCH_MAX_LINE_OUTPUT = ISO_DATE_PATTERN.maxLength() + 1;
+
+constexpr bool isBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
 
-    // Estimate Ethiopian year
-    int eYear = gYear - 8;
-    if (gMonth > 9 || (gMonth == 9 && gDay >= newYearDay)) {
-        eYear++;
+// Parse exactly three integers from a line. Fields are separated by '-', '/' or blanks
+// (a '-' or '/' may have blanks around it); a leading '-' is only accepted on the year.
+// Anything else, including trailing text after the day, makes the line malformed (-1).
+constexpr int parseDateFields(const char* p, const char* end, int fields[3]) {
+    while (p < end && isBlank(*p)) ++p;
+    for (int count = 0; count < 3; ++count) {
+        if (count > 0) {
+            // Separator: blanks, at most one '-' or '/', blanks
+            const char* start = p;
+            while (p < end && isBlank(*p)) ++p;
+            if (p < end && (*p == '-' || *p == '/')) {
+                ++p;
+                while (p < end && isBlank(*p)) ++p;
+            }
+            if (p == start) return -1;
+        }
+        bool negative = false;
+        if (count == 0 && p < end && *p == '-') {
+            negative = true;
+            ++p;
+        }
+        if (p == end || *p < '0' || *p > '9') return -1;
+        int value = 0;
+        while (p < end && *p >= '0' && *p <= '9') {
+            if (value > 99999999) return -1; // too many digits
+            value = value * 10 + (*p - '0');
+            ++p;
+        }
+        fields[count] = negative ? -value : value;
     }
+    while (p < end && isBlank(*p)) ++p;
+    return p == end ? 3 : -1;
+}
 
-    newYearDate.tm_year = (eYear + 8) - 1900;
-    newYearDate.tm_mon = 8;
-    newYearDate.tm_mday = newYearDay;
+// Convert a single line and append the result (with trailing newline) to `out`. Dates are
+// written with ISO_DATE_PATTERN, like the server's replies.
+constexpr char* convertBatchLine(bool gregorianToEthiopian, const char* line, const char* end, char* out) {
+    int f[3] = {};
+    bool valid = parseDateFields(line, end, f) == 3 &&
+                 (gregorianToEthiopian ? isValidGregorianDate(f[0], f[1], f[2]) : isValidEthiopianDate(f[0], f[1], f[2]));
+    if (!valid) return copy_n("invalid\n", 8, out);
 
-    // Calculate date difference
-    time_t gTime = mktime(&gDate);
-    time_t newYearTime = mktime(&newYearDate);
-    int dayDiff = static_cast<int>(difftime(gTime, newYearTime) / (60 * 60 * 24));
+    if (gregorianToEthiopian) out = ISO_DATE_PATTERN.format(out, jdnToEthiopian(gregorianToJdn(f[0], f[1], f[2])));
+    else out = ISO_DATE_PATTERN.format(out, jdnToGregorian(ethiopianToJdn(f[0], f[1], f[2])));
+    *out++ = '\n';
+    return out;
+}
+
+// Convert the lines of [p, end) into `out`, one result per line (an empty line is "invalid"),
+// and return where conversion stopped: at `end`, before a last line with no '\n' unless
+// `lastLineComplete`, or once fewer than BATCH_MAX_LINE_OUTPUT bytes are left before
+// `outEnd`. `out` and `lines` are advanced past the lines converted.
+constexpr const char* convertBatchLines(bool gregorianToEthiopian, const char* p, const char* end, bool lastLineComplete,
+                                        char*& out, const char* outEnd, uint64_t& lines) {
+    while (p < end && static_cast<size_t>(outEnd - out) >= BATCH_MAX_LINE_OUTPUT) {
+        const char* nl = find(p, end, '\n');
+        if (nl == end && !lastLineComplete) break;
+
+        const char* lineEnd = nl;
+        if (lineEnd > p && *(lineEnd - 1) == '\r') --lineEnd;
+        out = convertBatchLine(gregorianToEthiopian, p, lineEnd, out);
+        ++lines;
+        p = (nl < end) ? nl + 1 : end;
+    }
+    return p;
+}
+
+static_assert([] {
+    constexpr string_view input = "2024-09-11\n\n2024-09-12\r\n   \n2024 9 13";
+    char output[5 * BATCH_MAX_LINE_OUTPUT] = {};
+    char* out = output;
+    uint64_t lines = 0;
+    const char* stop = convertBatchLines(true, input.data(), input.data() + input.size(), false, out, output + sizeof(output), lines);
+    bool carried = stop == input.data() + input.rfind('\n') + 1 && lines == 4 &&
+                   string_view(output, out - output) == "2017-01-01\ninvalid\n2017-01-02\ninvalid\n";
+    stop = convertBatchLines(true, stop, input.data() + input.size(), true, out, output + sizeof(output), lines);
+    return carried && stop == input.data() + input.size() && lines == 5 &&
+           string_view(output, out - output).ends_with("invalid\n2017-01-03\n");
+}(), "blank lines answer \"invalid\" in place, and a last line without '\\n' waits for more input");
 
-    // Adjust for previous Ethiopian year
-    if (dayDiff < 0) {
-        dayDiff += 365;
-        if (((eYear + 7) % 4) == 3) {
-            dayDiff += 1;
+// Stream every line of `in` through the converter. Returns 0 on success, 1 on I/O error.
+int runBatchConversion(bool gregorianToEthiopian, FILE* in, FILE* out) {
+    static char input[BATCH_BUFFER_SIZE];
+    static char output[BATCH_BUFFER_SIZE + 64];
+    size_t pending = 0; // bytes of an incomplete line carried over from the previous read
+    size_t used = 0;
+
+    while (true) {
+        size_t got = fread(input + pending, 1, BATCH_BUFFER_SIZE - pending, in);
+        size_t avail = pending + got;
+        bool eof = (got == 0);
+        if (avail == 0) break;
+
+        const char* p = input;
+        const char* end = input + avail;
+        // One latency sample per buffer of lines
+        OperationTimer timer(gregorianToEthiopian ? StatOp::GregorianToEthiopian : StatOp::EthiopianToGregorian, 0);
+        uint64_t lines = 0;
+        // Carry a partial last line into the next read, unless input ended or the line fills the buffer
+        bool lastLineComplete = eof || (avail == BATCH_BUFFER_SIZE && memchr(input, '\n', avail) == nullptr);
+        while (true) {
+            char* written = output + used;
+            p = convertBatchLines(gregorianToEthiopian, p, end, lastLineComplete, written, output + BATCH_BUFFER_SIZE, lines);
+            used = written - output;
+            if (BATCH_BUFFER_SIZE - used >= BATCH_MAX_LINE_OUTPUT) break;
+            if (fwrite(output, 1, used, out) != used) return 1;
+            used = 0;
         }
+        timer.setItems(lines);
+
+        pending = end - p;
+        memmove(input, p, pending);
+        if (eof) break;
     }
 
-    int eMonth = dayDiff / 30 + 1;
-    int eDay = dayDiff % 30 + 1;
+    if (used > 0 && fwrite(output, 1, used, out) != used) return 1;
+    return fflush(out) == 0 ? 0 : 1;
+}
 
-    // Display result
-    cout << "Gregorian Date: " << gYear << "-" << gMonth << "-" << gDay << endl;
-    cout << "Ethiopian Date: " << eYear << "-" << eMonth << "-" << eDay << endl;
+// Entry point for "--g2e [file]" / "--e2g [file]"
+int runBatchMode(bool gregorianToEthiopian, const char* path) {
+    FILE* in = stdin;
+    if (path != nullptr) {
+        in = fopen(path, "rb");
+        if (in == nullptr) {
+            fprintf(stderr, "Cannot open %s\n", path);
+            return 1;
+        }
+    }
+
+    int status = runBatchConversion(gregorianToEthiopian, in, stdout);
+    if (in != stdin) fclose(in);
+    return status;
 }
 
-// Convert Ethiopian date to Gregorian date
-void convertEthiopianToGregorian(int eYear, int eMonth, int eDay) {
-    // Validate Ethiopian date
-    if (eMonth < 1 || eMonth > 13 || eDay < 1 || eDay > 30 || (eMonth == 13 && eDay > (isLeapYear(eYear) ? 6 : 5))) {
-        cout << "Invalid Ethiopian date.\n";
-        return;
+// ---------------------------------------------------------------------------------------
+// Parallel multi-year rendering
+// Years are rendered concurrently into per-year buffers on a work-stealing pool and then
+// written out in year order.
+// ---------------------------------------------------------------------------------------
+
+// A fixed set of worker threads that run indexed tasks. Each run() splits the indices into
+// one contiguous block per worker; a worker takes tasks from the front of its own deque and,
+// once that is empty, steals from the back of the other workers' deques.
+class WorkStealingPool {
+public:
+    explicit WorkStealingPool(unsigned int threadCount) {
+        if (threadCount == 0) threadCount = 1;
+        for (unsigned int i = 0; i < threadCount; ++i) queues.push_back(make_unique<WorkerQueue>());
+        for (unsigned int i = 0; i < threadCount; ++i) threads.emplace_back(&WorkStealingPool::workerLoop, this, i);
+    }
+
+    ~WorkStealingPool() {
+        {
+            lock_guard<mutex> lock(stateLock);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (thread& t : threads) t.join();
+    }
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    size_t size() const {
+        return threads.size();
+    }
+
+    // Run task(0) .. task(taskCount - 1) and wait for all of them to finish
+    void run(size_t taskCount, const function<void(size_t)>& task) {
+        if (taskCount == 0) return;
+        {
+            lock_guard<mutex> lock(stateLock);
+            remaining = taskCount;
+        }
+
+        size_t workers = queues.size();
+        for (size_t w = 0; w < workers; ++w) {
+            lock_guard<mutex> lock(queues[w]->lock);
+            for (size_t i = taskCount * w / workers; i < taskCount * (w + 1) / workers; ++i) {
+                queues[w]->tasks.push_back(QueuedTask{&task, i});
+            }
+        }
+
+        unique_lock<mutex> lock(stateLock);
+        ++generation;
+        wake.notify_all();
+        finished.wait(lock, [this] { return remaining == 0; });
     }
 
-    int gYear = eYear + 7;
-    bool gLeap = ((gYear % 4 == 0 && gYear % 100 != 0) || (gYear % 400 == 0));
-    int newYearDay = gLeap ? 12 : 11;
+private:
+    // Each index carries its own job: a worker still draining queues after run() returns
+    // may pick up an index from the next run(), and must call that run's function
+    struct QueuedTask {
+        const function<void(size_t)>* job;
+        size_t index;
+    };
 
-    // Calculate days passed from 1 Meskerem
-    int daysFromNewYear = (eMonth - 1) * 30 + (eDay - 2);
+    struct WorkerQueue {
+        mutex lock;
+        deque<QueuedTask> tasks;
+    };
 
-    struct tm newYearDate = {0};
-    newYearDate.tm_year = gYear - 1900;
-    newYearDate.tm_mon = 8;
-    newYearDate.tm_mday = newYearDay;
+    bool takeTask(size_t self, QueuedTask& task) {
+        {
+            WorkerQueue& own = *queues[self];
+            lock_guard<mutex> lock(own.lock);
+            if (!own.tasks.empty()) {
+                task = own.tasks.front();
+                own.tasks.pop_front();
+                return true;
+            }
+        }
+        for (size_t k = 1; k < queues.size(); ++k) {
+            WorkerQueue& victim = *queues[(self + k) % queues.size()];
+            lock_guard<mutex> lock(victim.lock);
+            if (!victim.tasks.empty()) {
+                task = victim.tasks.back();
+                victim.tasks.pop_back();
+                return true;
+            }
+        }
+        return false;
+    }
 
-    // Add the days to New Year to get Gregorian date
-    time_t newYearTime = mktime(&newYearDate);
-    time_t targetTime = newYearTime + daysFromNewYear * 24 * 60 * 60;
+    void workerLoop(size_t self) {
+        size_t seenGeneration = 0;
+        while (true) {
+            {
+                unique_lock<mutex> lock(stateLock);
+                wake.wait(lock, [&] { return stopping || generation != seenGeneration; });
+                if (stopping) return;
+                seenGeneration = generation;
+            }
+
+            QueuedTask task;
+            size_t done = 0;
+            while (takeTask(self, task)) {
+                (*task.job)(task.index);
+                ++done;
+            }
 
-    struct tm* result = localtime(&targetTime);
-    cout << "Ethiopian Date: " << eYear << "-" << eMonth << "-" << eDay << endl;
-    cout << "Gregorian Date: " << result->tm_year + 1900 << "-"
-         << result->tm_mon + 1 << "-" << result->tm_mday << endl;
+            if (done > 0) {
+                lock_guard<mutex> lock(stateLock);
+                remaining -= done;
+                if (remaining == 0) finished.notify_all();
+            }
+        }
+    }
+
+    vector<unique_ptr<WorkerQueue>> queues;
+    vector<thread> threads;
+    mutex stateLock;
+    condition_variable wake, finished;
+    size_t remaining = 0;
+    size_t generation = 0;
+    bool stopping = false;
+};
+
+// Every rendered year is held in memory until the whole range is written, so ranges are capped
+const int MAX_RENDER_YEARS = 10000;
+
+// Render years `firstYear`..`lastYear` of either calendar in parallel and write them in order
+int runMultiYearRender(bool ethiopian, int firstYear, int lastYear, unsigned int threadCount) {
+    if (lastYear < firstYear || static_cast<int64_t>(lastYear) - firstYear >= MAX_RENDER_YEARS) {
+        fprintf(stderr, "Invalid year range %d..%d (at most %d years)\n", firstYear, lastYear, MAX_RENDER_YEARS);
+        return 1;
+    }
+
+    size_t yearCount = static_cast<size_t>(lastYear - firstYear) + 1;
+    vector<string> rendered(yearCount);
+
+    WorkStealingPool pool(threadCount);
+    pool.run(yearCount, [&](size_t i) {
+        thread_local RenderBuffer buffer;
+        int year = firstYear + static_cast<int>(i);
+        renderCalendar(buffer, RenderKey{ethiopian ? CalendarKind::Ethiopian : CalendarKind::Gregorian, RenderFormat::Year, year, 0});
+        rendered[i].assign(buffer.data, buffer.length);
+    });
+
+    for (const string& text : rendered) {
+        if (fwrite(text.data(), 1, text.size(), stdout) != text.size()) return 1;
+    }
+    return fflush(stdout) == 0 ? 0 : 1;
 }
 
-// Display Gregorian calendar for the whole year
-void displayGregorianCalendar(int year) {
-    cout << "\nGregorian Calendar for " << year << "\n";
+// ---------------------------------------------------------------------------------------
+// Verification
+// "--verify [FROM TO] [threads]" checks every day of Gregorian years FROM..TO (default
+// -50000..50000, about 36.5 million days) against a deliberately slow reference calendar
+// that counts years, months and days one at a time and shares no code with the engine.
+// For each day it checks the scalar, span and day-range paths, both round trips, the JDN
+// kernels at every SIMD level the host supports, and a format -> parse round trip of the day
+// in each text form (the parser is also run at every level).
+// Work is split into blocks of days on the work-stealing pool; the lowest failing day wins.
+// ---------------------------------------------------------------------------------------
+
+// Reference calendars: plain rules, stepped one day at a time
+bool referenceGregorianLeap(int year) {
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+int referenceGregorianMonthLength(int year, int month) {
+    static const int lengths[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    return month == 2 && referenceGregorianLeap(year) ? 29 : lengths[month - 1];
+}
+
+bool referenceEthiopianLeap(int year) {
+    return ((year % 4) + 4) % 4 == 3;
+}
+
+int referenceEthiopianMonthLength(int year, int month) {
+    return month < 13 ? 30 : (referenceEthiopianLeap(year) ? 6 : 5);
+}
+
+void referenceNextGregorian(GregorianDate& d) {
+    if (++d.day > referenceGregorianMonthLength(d.year, d.month)) {
+        d.day = 1;
+        if (++d.month > 12) {
+            d.month = 1;
+            ++d.year;
+        }
+    }
+}
+
+void referenceNextEthiopian(EthiopianDate& d) {
+    if (++d.day > referenceEthiopianMonthLength(d.year, d.month)) {
+        d.day = 1;
+        if (++d.month > 13) {
+            d.month = 1;
+            ++d.year;
+        }
+    }
+}
+
+// Anchors: 1 January 2000 (Gregorian) is JDN 2451545, a Saturday; 1 Meskerem 1993 is 11 September 2000
+const DayNumber REFERENCE_GREGORIAN_ANCHOR = 2451545;
+const DayNumber REFERENCE_ETHIOPIAN_ANCHOR = 2451799;
+const int REFERENCE_ANCHOR_WEEKDAY = 5; // 0 = Monday
+
+// Gregorian date of `jdn`, found by walking whole years and months from the anchor
+GregorianDate referenceGregorianDate(DayNumber jdn) {
+    DayNumber offset = jdn - REFERENCE_GREGORIAN_ANCHOR;
+    int year = 2000;
+    while (offset < 0) offset += referenceGregorianLeap(--year) ? 366 : 365;
+    while (offset >= (referenceGregorianLeap(year) ? 366 : 365)) offset -= referenceGregorianLeap(year++) ? 366 : 365;
+    int month = 1;
+    while (offset >= referenceGregorianMonthLength(year, month)) offset -= referenceGregorianMonthLength(year, month++);
+    return GregorianDate{year, month, static_cast<int>(offset) + 1};
+}
+
+EthiopianDate referenceEthiopianDate(DayNumber jdn) {
+    DayNumber offset = jdn - REFERENCE_ETHIOPIAN_ANCHOR;
+    int year = 1993;
+    while (offset < 0) offset += referenceEthiopianLeap(--year) ? 366 : 365;
+    while (offset >= (referenceEthiopianLeap(year) ? 366 : 365)) offset -= referenceEthiopianLeap(year++) ? 366 : 365;
+    int month = 1;
+    while (offset >= referenceEthiopianMonthLength(year, month)) offset -= referenceEthiopianMonthLength(year, month++);
+    return EthiopianDate{year, month, static_cast<int>(offset) + 1};
+}
+
+struct VerifyFailure {
+    DayNumber jdn;
+    string check, expected, actual;
+};
+
+string describeDate(int year, int month, int day) {
+    char text[48];
+    snprintf(text, sizeof(text), "%d-%02d-%02d", year, month, day);
+    return text;
+}
+
+// SIMD levels the host can run, narrowest first; every one of them is verified
+vector<SimdLevel> supportedSimdLevels() {
+    vector<SimdLevel> levels{SimdLevel::Scalar};
+    SimdLevel best = detectSimdLevel();
+    if (best == SimdLevel::Avx2 || best == SimdLevel::Avx512) levels.push_back(SimdLevel::Avx2);
+    if (best == SimdLevel::Avx512) levels.push_back(SimdLevel::Avx512);
+    return levels;
+}
+
+// Text forms each day is written in and parsed back from
+struct VerifyTextFormat {
+    const char* name;
+    const DatePattern& pattern;
+    DateFormat format;
+    bool ethiopian;
+};
 
-    string months[12] = {
-        "January", "February", "March", "April", "May", "June",
-        "July", "August", "September", "October", "November", "December"
+inline constexpr DatePattern VERIFY_DAY_MONTH_YEAR_PATTERN("%d/%m/%Y");
+inline constexpr DatePattern VERIFY_MONTH_NAME_PATTERN("%B %-d %Y");
+
+const VerifyTextFormat VERIFY_TEXT_FORMATS[] = {
+    {"Gregorian ISO", ISO_DATE_PATTERN, DateFormat::Iso, false},
+    {"Ethiopian ISO", ISO_DATE_PATTERN, DateFormat::Iso, true},
+    {"Gregorian DD/MM/YYYY", VERIFY_DAY_MONTH_YEAR_PATTERN, DateFormat::DayMonthYear, false},
+    {"Ethiopian DD/MM/YYYY", VERIFY_DAY_MONTH_YEAR_PATTERN, DateFormat::DayMonthYear, true},
+    {"Ethiopian month name", VERIFY_MONTH_NAME_PATTERN, DateFormat::EthiopianMonthName, true},
+};
+
+// Check days [first, last) of one block against the reference calendar at every SIMD level
+// in `levels`. Reports the lowest failing day of the block, whichever check found it.
+bool verifyDayBlock(DayNumber first, DayNumber last, const vector<SimdLevel>& levels, VerifyFailure& failure) {
+    const size_t count = static_cast<size_t>(last - first);
+    vector<GregorianDate> gregorian(count), gregorianBack(count), referenceGregorian(count), kernelGregorian(count);
+    vector<EthiopianDate> ethiopian(count), ethiopianBack(count), referenceEthiopian(count), kernelEthiopian(count);
+    vector<int> jdns(count);
+    bool kernelRange = isKernelJdn(first) && isKernelJdn(last - 1);
+
+    for (size_t i = 0; i < count; ++i) {
+        gregorian[i] = jdnToGregorian(first + static_cast<DayNumber>(i));
+        ethiopian[i] = jdnToEthiopian(first + static_cast<DayNumber>(i));
+        jdns[i] = static_cast<int>(first + static_cast<DayNumber>(i));
+    }
+    convertGregorianToEthiopian(span<const GregorianDate>(gregorian), span<EthiopianDate>(ethiopianBack));
+    convertEthiopianToGregorian(span<const EthiopianDate>(ethiopian), span<GregorianDate>(gregorianBack));
+
+    GregorianDate refG = referenceGregorianDate(first);
+    EthiopianDate refE = referenceEthiopianDate(first);
+    int refWeekday = static_cast<int>(((first - REFERENCE_GREGORIAN_ANCHOR) % 7 + 7 + REFERENCE_ANCHOR_WEEKDAY) % 7);
+    DayIterator walker(first);
+
+    // Days [0, limit) have passed every check so far; later checks only need to look there
+    size_t limit = count;
+    auto sameG = [](const GregorianDate& a, const GregorianDate& b) { return a.year == b.year && a.month == b.month && a.day == b.day; };
+    auto sameE = [](const EthiopianDate& a, const EthiopianDate& b) { return a.year == b.year && a.month == b.month && a.day == b.day; };
+    auto fail = [&](size_t i, string check, string expected, string actual) {
+        failure = VerifyFailure{first + static_cast<DayNumber>(i), move(check), move(expected), move(actual)};
+        limit = i;
     };
 
-    int daysInMonth[12] = {
-        31, 28, 31, 30, 31, 30,
-        31, 31, 30, 31, 30, 31
+    // Scalar conversions, span batches, the day range and weekdays, stepped with the reference
+    for (size_t i = 0; i < count; ++i, ++walker) {
+        DayNumber jdn = first + static_cast<DayNumber>(i);
+        const GregorianDate& g = gregorian[i];
+        const EthiopianDate& e = ethiopian[i];
+        referenceGregorian[i] = refG;
+        referenceEthiopian[i] = refE;
+
+        if (!sameG(g, refG)) {
+            fail(i, "jdnToGregorian", describeDate(refG.year, refG.month, refG.day), describeDate(g.year, g.month, g.day));
+            break;
+        }
+        if (!sameE(e, refE)) {
+            fail(i, "jdnToEthiopian", describeDate(refE.year, refE.month, refE.day), describeDate(e.year, e.month, e.day));
+            break;
+        }
+        if (gregorianToJdn(g.year, g.month, g.day) != jdn) {
+            fail(i, "gregorianToJdn round trip", to_string(jdn), to_string(gregorianToJdn(g.year, g.month, g.day)));
+            break;
+        }
+        if (ethiopianToJdn(e.year, e.month, e.day) != jdn) {
+            fail(i, "ethiopianToJdn round trip", to_string(jdn), to_string(ethiopianToJdn(e.year, e.month, e.day)));
+            break;
+        }
+        if (!sameE(ethiopianBack[i], refE)) {
+            const EthiopianDate& x = ethiopianBack[i];
+            fail(i, "convertGregorianToEthiopian", describeDate(refE.year, refE.month, refE.day), describeDate(x.year, x.month, x.day));
+            break;
+        }
+        if (!sameG(gregorianBack[i], refG)) {
+            const GregorianDate& x = gregorianBack[i];
+            fail(i, "convertEthiopianToGregorian", describeDate(refG.year, refG.month, refG.day), describeDate(x.year, x.month, x.day));
+            break;
+        }
+        CalendarDay day = *walker;
+        if (!sameG(day.gregorian, refG) || !sameE(day.ethiopian, refE)) {
+            fail(i, "DayRange", describeDate(refG.year, refG.month, refG.day) + " / " + describeDate(refE.year, refE.month, refE.day),
+                 describeDate(day.gregorian.year, day.gregorian.month, day.gregorian.day) + " / " +
+                 describeDate(day.ethiopian.year, day.ethiopian.month, day.ethiopian.day));
+            break;
+        }
+        if (weekdayFromJdn(jdn) != refWeekday || day.weekday != refWeekday) {
+            fail(i, "weekday", to_string(refWeekday), to_string(weekdayFromJdn(jdn)) + " / " + to_string(day.weekday));
+            break;
+        }
+
+        referenceNextGregorian(refG);
+        referenceNextEthiopian(refE);
+        refWeekday = refWeekday == 6 ? 0 : refWeekday + 1;
+    }
+
+    // JDN column kernels, each level called explicitly
+    for (SimdLevel level : levels) {
+        if (!kernelRange || limit == 0) break;
+        span<const int> column(jdns.data(), limit);
+        jdnToGregorian(column, span<GregorianDate>(kernelGregorian), level);
+        jdnToEthiopian(column, span<EthiopianDate>(kernelEthiopian), level);
+        for (size_t i = 0; i < limit; ++i) {
+            const GregorianDate& g = kernelGregorian[i];
+            const EthiopianDate& e = kernelEthiopian[i];
+            if (!sameG(g, referenceGregorian[i])) {
+                const GregorianDate& r = referenceGregorian[i];
+                fail(i, string("jdnToGregorian (") + simdLevelName(level) + ")", describeDate(r.year, r.month, r.day),
+                     describeDate(g.year, g.month, g.day));
+            } else if (!sameE(e, referenceEthiopian[i])) {
+                const EthiopianDate& r = referenceEthiopian[i];
+                fail(i, string("jdnToEthiopian (") + simdLevelName(level) + ")", describeDate(r.year, r.month, r.day),
+                     describeDate(e.year, e.month, e.day));
+            }
+        }
+    }
+
+    // Format every day with DatePattern and parse it back at every level
+    vector<char> text;
+    vector<string_view> rows(count);
+    vector<ParsedDate> parsed(count);
+    for (const VerifyTextFormat& form : VERIFY_TEXT_FORMATS) {
+        if (limit == 0) break;
+        size_t stride = form.pattern.maxLength();
+        text.resize(limit * stride);
+        for (size_t i = 0; i < limit; ++i) {
+            char* start = text.data() + i * stride;
+            char* end = form.ethiopian ? form.pattern.format(start, referenceEthiopian[i])
+                                       : form.pattern.format(start, referenceGregorian[i]);
+            rows[i] = string_view(start, static_cast<size_t>(end - start));
+        }
+        for (SimdLevel level : levels) {
+            size_t checked = limit;
+            parseDates(span<const string_view>(rows.data(), checked), form.format, form.ethiopian,
+                       span<ParsedDate>(parsed.data(), checked), level);
+            for (size_t i = 0; i < checked; ++i) {
+                const ParsedDate& d = parsed[i];
+                int year = form.ethiopian ? referenceEthiopian[i].year : referenceGregorian[i].year;
+                int month = form.ethiopian ? referenceEthiopian[i].month : referenceGregorian[i].month;
+                int day = form.ethiopian ? referenceEthiopian[i].day : referenceGregorian[i].day;
+                if (d.status != ParseStatus::Ok || d.year != year || d.month != month || d.day != day) {
+                    fail(i, string("format/parse ") + form.name + " (" + simdLevelName(level) + ")",
+                         describeDate(year, month, day) + " from \"" + string(rows[i]) + "\"",
+                         d.status == ParseStatus::Ok ? describeDate(d.year, d.month, d.day)
+                                                     : d.status == ParseStatus::Malformed ? "malformed" : "invalid date");
+                    break;
+                }
+            }
+        }
+    }
+    return limit == count;
+}
+
+// About 365 million days; ten times the default range
+const int MAX_VERIFY_YEARS = 1000000;
+
+// Entry point for "--verify [FROM TO] [threads]". Returns 0 when every day agrees.
+int runVerification(int firstYear, int lastYear, unsigned int threadCount) {
+    if (lastYear < firstYear || static_cast<int64_t>(lastYear) - firstYear >= MAX_VERIFY_YEARS ||
+        !isKernelJdn(gregorianToJdn(firstYear, 1, 1)) || !isKernelJdn(gregorianToJdn(lastYear + 1, 1, 1))) {
+        fprintf(stderr, "Invalid year range %d..%d (at most %d years)\n", firstYear, lastYear, MAX_VERIFY_YEARS);
+        return 1;
+    }
+    const DayNumber BLOCK_DAYS = 1 << 16;
+    DayNumber first = gregorianToJdn(firstYear, 1, 1);
+    DayNumber last = gregorianToJdn(lastYear + 1, 1, 1);
+    size_t blocks = static_cast<size_t>((last - first + BLOCK_DAYS - 1) / BLOCK_DAYS);
+
+    vector<SimdLevel> levels = supportedSimdLevels();
+    mutex failureLock;
+    VerifyFailure firstFailure{INT64_MAX, "", "", ""};
+    auto started = chrono::steady_clock::now();
+
+    WorkStealingPool pool(threadCount);
+    pool.run(blocks, [&](size_t b) {
+        DayNumber blockFirst = first + static_cast<DayNumber>(b) * BLOCK_DAYS;
+        DayNumber blockLast = min(blockFirst + BLOCK_DAYS, last);
+        {
+            // A block entirely after a known failure cannot change the report
+            lock_guard<mutex> guard(failureLock);
+            if (blockFirst > firstFailure.jdn) return;
+        }
+        VerifyFailure failure;
+        if (!verifyDayBlock(blockFirst, blockLast, levels, failure)) {
+            lock_guard<mutex> guard(failureLock);
+            if (failure.jdn < firstFailure.jdn) firstFailure = move(failure);
+        }
+    });
+
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+    if (firstFailure.jdn != INT64_MAX) {
+        GregorianDate g = referenceGregorianDate(firstFailure.jdn);
+        printf("FAILED: first divergence at JDN %lld (%s): %s expected %s, got %s\n",
+               static_cast<long long>(firstFailure.jdn), describeDate(g.year, g.month, g.day).c_str(),
+               firstFailure.check.c_str(), firstFailure.expected.c_str(), firstFailure.actual.c_str());
+        return 1;
+    }
+    string levelNames;
+    for (SimdLevel level : levels) levelNames += string(levelNames.empty() ? "" : ", ") + simdLevelName(level);
+    printf("OK: %lld days verified (Gregorian years %d..%d, JDN %lld..%lld; %s) in %.2f s on %zu threads\n",
+           static_cast<long long>(last - first), firstYear, lastYear, static_cast<long long>(first),
+           static_cast<long long>(last - 1), levelNames.c_str(), seconds, pool.size());
+    return 0;
+}
+
+// ---------------------------------------------------------------------------------------
+// Conversion server
+// "--serve ADDRESS [threads] [cache-MiB]" keeps the converter resident and answers requests over a Unix
+// domain socket (ADDRESS is a path) or loopback TCP (ADDRESS is 127.0.0.1:PORT or
+// localhost:PORT). Every worker thread runs its own epoll loop; the listening socket is
+// shared with EPOLLEXCLUSIVE, so each new client is accepted and then served by one worker.
+//
+// The protocol is one request per line, one reply per request, in order. Clients may
+// pipeline any number of requests without waiting; conversions are answered in batches.
+//   PING                 -> OK PONG
+//   G2E YYYY-MM-DD       -> OK YYYY-MM-DD        (Gregorian to Ethiopian)
+//   E2G YYYY-MM-DD       -> OK YYYY-MM-DD        (Ethiopian to Gregorian)
+//   HOLIDAY YYYY-MM-DD   -> OK <name> or OK -    (Ethiopian date; two names are joined by "; ")
+//   ETHIOPIAN-YEAR YYYY  -> DATA <length>, a newline, then <length> bytes of calendar
+//   GREGORIAN-YEAR YYYY  -> DATA <length>, a newline, then <length> bytes of calendar
+//   ETHIOPIAN-MONTH YYYY MM, GREGORIAN-MONTH YYYY MM -> DATA, as above, for one month
+//   CACHE-STATS          -> OK hits=.. misses=.. evictions=.. entries=.. bytes=.. limit=..
+//   STATS [JSON]         -> DATA, as above, with operation counters and latency histograms
+//                           (Prometheus text by default)
+//   QUIT                 -> the server closes the connection
+// Failures reply "ERR <reason>" and the connection stays usable.
+// ---------------------------------------------------------------------------------------
+
+const size_t SERVER_MAX_LINE = 4096;
+const size_t SERVER_READ_SIZE = 64 * 1024;
+// Stop reading from a client that is not collecting its replies
+const size_t SERVER_MAX_PENDING_OUTPUT = 4 << 20;
+
+// Written to by the signal handler; every worker's epoll watches it
+int serverStopFd = -1;
+
+void requestServerStop(int) {
+    uint64_t one = 1;
+    ssize_t ignored = write(serverStopFd, &one, sizeof(one));
+    (void)ignored;
+}
+
+// A piece of pending output: reply text owned by the connection, or a cached render that is
+// written straight from the cache
+struct ServerSegment {
+    string text;
+    shared_ptr<const string> shared;
+
+    string_view view() const {
+        return shared ? string_view(*shared) : string_view(text);
+    }
+};
+
+struct ServerConnection {
+    int fd;
+    string input;                // bytes of request lines not handled yet
+    deque<ServerSegment> output; // replies the socket has not accepted yet, written with one writev
+    size_t outputSent = 0;    // prefix of output.front() already written
+    size_t outputPending = 0; // total unwritten bytes
+    bool closing = false;     // QUIT seen or peer finished sending: close once output drains
+};
+
+// Short replies are appended to the last output segment
+void appendServerReply(ServerConnection& c, string_view text) {
+    if (c.output.empty() || c.output.back().shared) c.output.emplace_back();
+    c.output.back().text += text;
+    c.outputPending += text.size();
+}
+
+// Cached renders are queued by reference instead of being copied into the reply text
+void appendServerSegment(ServerConnection& c, shared_ptr<const string> payload) {
+    c.outputPending += payload->size();
+    c.output.push_back(ServerSegment{string(), move(payload)});
+}
+
+// Parse "YYYY-MM-DD" for the server, replying with an error when it is not a valid date
+bool parseServerDate(string_view text, bool ethiopian, ParsedDate& date, ServerConnection& c) {
+    date = parseDate(text, DateFormat::Iso, ethiopian);
+    if (date.status == ParseStatus::Ok) return true;
+    appendServerReply(c, date.status == ParseStatus::Malformed ? "ERR expected YYYY-MM-DD\n" : "ERR invalid date\n");
+    return false;
+}
+
+// Handle one request line other than G2E / E2G; returns false for QUIT
+bool handleServerRequest(string_view line, ServerConnection& c) {
+    size_t space = line.find(' ');
+    string_view command = line.substr(0, space);
+    string_view argument = space == string_view::npos ? string_view() : line.substr(space + 1);
+
+    if (command == "HOLIDAY") {
+        ParsedDate date;
+        if (!parseServerDate(argument, true, date, c)) return true;
+        array<string_view, 2> names;
+        {
+            OperationTimer timer(StatOp::HolidayLookup);
+            names = getEthiopianHoliday(date.year, date.month, date.day);
+        }
+        appendServerReply(c, "OK ");
+        if (names[0].empty() && names[1].empty()) appendServerReply(c, "-");
+        appendServerReply(c, names[0]);
+        if (!names[0].empty() && !names[1].empty()) appendServerReply(c, "; ");
+        appendServerReply(c, names[1]);
+        appendServerReply(c, "\n");
+    } else if (command == "ETHIOPIAN-YEAR" || command == "GREGORIAN-YEAR" ||
+               command == "ETHIOPIAN-MONTH" || command == "GREGORIAN-MONTH") {
+        RenderKey key{command.starts_with("ETHIOPIAN") ? CalendarKind::Ethiopian : CalendarKind::Gregorian,
+                      command.ends_with("YEAR") ? RenderFormat::Year : RenderFormat::Month, 0, 0};
+        const char* p = argument.data();
+        const char* end = p + argument.size();
+        if (argument.empty() || (p = parseYear(p, end, key.year)) == nullptr) p = nullptr;
+        if (p != nullptr && key.format == RenderFormat::Month) {
+            int lastMonth = key.calendar == CalendarKind::Ethiopian ? 13 : 12;
+            if (p == end || *p++ != ' ' || (p = parseDigits(p, end, 2, key.month)) == nullptr || key.month < 1 ||
+                key.month > lastMonth) {
+                p = nullptr;
+            }
+        }
+        if (p != end) {
+            appendServerReply(c, key.format == RenderFormat::Year ? "ERR expected a year\n" : "ERR expected a year and month\n");
+            return true;
+        }
+        shared_ptr<const string> text = renderCache().get(key);
+        char header[32] = "DATA ";
+        char* headerEnd = appendInt(header + 5, static_cast<int>(text->size()));
+        *headerEnd++ = '\n';
+        appendServerReply(c, string_view(header, headerEnd - header));
+        appendServerSegment(c, move(text));
+    } else if (command == "CACHE-STATS") {
+        RenderCacheStats stats = renderCache().stats();
+        char reply[256];
+        snprintf(reply, sizeof(reply), "OK hits=%llu misses=%llu evictions=%llu entries=%zu bytes=%zu limit=%zu\n",
+                 static_cast<unsigned long long>(stats.hits), static_cast<unsigned long long>(stats.misses),
+                 static_cast<unsigned long long>(stats.evictions), stats.entries, stats.bytes, stats.byteLimit);
+        appendServerReply(c, reply);
+    } else if (command == "STATS") {
+        if (argument != "" && argument != "JSON" && argument != "PROMETHEUS") {
+            appendServerReply(c, "ERR expected STATS [JSON|PROMETHEUS]\n");
+            return true;
+        }
+        auto text = make_shared<const string>(argument == "JSON" ? formatStatsJson() : formatStatsPrometheus());
+        char header[32] = "DATA ";
+        char* headerEnd = appendInt(header + 5, static_cast<int>(text->size()));
+        *headerEnd++ = '\n';
+        appendServerReply(c, string_view(header, headerEnd - header));
+        appendServerSegment(c, move(text));
+    } else if (command == "PING") {
+        appendServerReply(c, "OK PONG\n");
+    } else if (command == "QUIT") {
+        return false;
+    } else {
+        appendServerReply(c, "ERR unknown command\n");
+    }
+    return true;
+}
+
+// Pipelined conversions are gathered into batches of up to this many dates
+const size_t SERVER_BATCH_SIZE = 1024;
+
+// Convert a run of consecutive G2E (or E2G) arguments with one bulk parse and one bulk
+// day-number conversion, and append all of their replies at once
+void convertServerBatch(bool fromGregorian, span<const string_view> dates, ServerConnection& c) {
+    thread_local ParsedDate parsed[SERVER_BATCH_SIZE];
+    thread_local int jdns[SERVER_BATCH_SIZE];
+    thread_local EthiopianDate ethiopianOut[SERVER_BATCH_SIZE];
+    thread_local GregorianDate gregorianOut[SERVER_BATCH_SIZE];
+    thread_local char replies[SERVER_BATCH_SIZE * 32];
+    size_t count = dates.size();
+    OperationTimer timer(fromGregorian ? StatOp::GregorianToEthiopian : StatOp::EthiopianToGregorian, count);
+
+    parseDates(dates, DateFormat::Iso, !fromGregorian, span<ParsedDate>(parsed, count));
+    bool kernelRange = true;
+    for (size_t i = 0; i < count; ++i) {
+        const ParsedDate& d = parsed[i];
+        DayNumber jdn = 0;
+        if (d.status == ParseStatus::Ok) {
+            jdn = fromGregorian ? gregorianToJdn(d.year, d.month, d.day) : ethiopianToJdn(d.year, d.month, d.day);
+        }
+        kernelRange &= isKernelJdn(jdn);
+        jdns[i] = static_cast<int>(jdn);
+    }
+    if (kernelRange && fromGregorian) {
+        jdnToEthiopian(span<const int>(jdns, count), span<EthiopianDate>(ethiopianOut, count));
+    } else if (kernelRange) {
+        jdnToGregorian(span<const int>(jdns, count), span<GregorianDate>(gregorianOut, count));
+    } else {
+        // Years in the millions: convert this batch one date at a time in 64 bits
+        for (size_t i = 0; i < count; ++i) {
+            const ParsedDate& d = parsed[i];
+            if (d.status != ParseStatus::Ok) continue;
+            if (fromGregorian) ethiopianOut[i] = jdnToEthiopian(gregorianToJdn(d.year, d.month, d.day));
+            else gregorianOut[i] = jdnToGregorian(ethiopianToJdn(d.year, d.month, d.day));
+        }
+    }
+
+    char* out = replies;
+    for (size_t i = 0; i < count; ++i) {
+        if (parsed[i].status == ParseStatus::Ok) {
+            memcpy(out, "OK ", 3);
+            out = fromGregorian ? ISO_DATE_PATTERN.format(out + 3, ethiopianOut[i]) : ISO_DATE_PATTERN.format(out + 3, gregorianOut[i]);
+            *out++ = '\n';
+        } else {
+            string_view error = parsed[i].status == ParseStatus::Malformed ? "ERR expected YYYY-MM-DD\n" : "ERR invalid date\n";
+            memcpy(out, error.data(), error.size());
+            out += error.size();
+        }
+    }
+    appendServerReply(c, string_view(replies, out - replies));
+}
+
+// Answer every complete line in the connection's input. Runs of G2E / E2G requests are
+// converted in batches; replies still come back one per line and in request order.
+void handleServerInput(ServerConnection& c) {
+    thread_local string_view batch[SERVER_BATCH_SIZE];
+    size_t batchSize = 0;
+    bool batchFromGregorian = false;
+    auto flushBatch = [&] {
+        if (batchSize > 0) convertServerBatch(batchFromGregorian, span<const string_view>(batch, batchSize), c);
+        batchSize = 0;
     };
 
-    // Adjust February for leap years
-    if ((year % 4 == 0 && year % 100 != 0) || (year % 400 == 0)) {
-        daysInMonth[1] = 29;
+    string_view input(c.input);
+    size_t start = 0;
+    while (!c.closing) {
+        size_t nl = input.find('\n', start);
+        if (nl == string_view::npos) break;
+        string_view line = input.substr(start, nl - start);
+        if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+        start = nl + 1;
+
+        bool g2e = line.starts_with("G2E "), e2g = line.starts_with("E2G ");
+        if (g2e || e2g) {
+            if (batchSize == SERVER_BATCH_SIZE || (batchSize > 0 && batchFromGregorian != g2e)) flushBatch();
+            batchFromGregorian = g2e;
+            batch[batchSize++] = line.substr(4);
+            continue;
+        }
+        flushBatch();
+        if (!handleServerRequest(line, c)) c.closing = true;
     }
+    flushBatch(); // the batch points into c.input, so it must be answered before the erase
 
-    for (int month = 0; month < 12; ++month) {
-        cout << "\n  " << months[month] << " " << year << "\n";
-        cout << "Sun Mon Tue Wed Thu Fri Sat\n";
+    c.input.erase(0, start);
+    if (c.input.size() > SERVER_MAX_LINE) {
+        appendServerReply(c, "ERR line too long\n");
+        c.closing = true;
+    }
+}
 
-        struct tm firstDay = {0};
-        firstDay.tm_year = year - 1900;
-        firstDay.tm_mon = month;
-        firstDay.tm_mday = 1;
-        mktime(&firstDay);
+// Write as much pending output as the socket takes, all segments in one writev per round;
+// returns false on a broken connection
+bool flushServerOutput(ServerConnection& c) {
+    while (c.outputPending > 0) {
+        iovec parts[64];
+        int partCount = 0;
+        size_t skip = c.outputSent;
+        for (const ServerSegment& segment : c.output) {
+            string_view bytes = segment.view();
+            if (partCount == 64) break;
+            if (bytes.size() == skip) {
+                skip = 0;
+                continue;
+            }
+            parts[partCount].iov_base = const_cast<char*>(bytes.data() + skip);
+            parts[partCount].iov_len = bytes.size() - skip;
+            ++partCount;
+            skip = 0;
+        }
 
-        int startWeekday = firstDay.tm_wday; // 0=Sunday
-        int day = 1;
+        ssize_t n = writev(c.fd, parts, partCount);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
 
-        // Print empty spaces before the first day
-        for (int i = 0; i < startWeekday; ++i) {
-            cout << "    ";
+        // Drop the segments that are now fully written
+        size_t written = static_cast<size_t>(n);
+        c.outputPending -= written;
+        written += c.outputSent;
+        while (!c.output.empty() && written >= c.output.front().view().size()) {
+            written -= c.output.front().view().size();
+            c.output.pop_front();
         }
+        c.outputSent = written;
+    }
+    c.output.clear();
+    c.outputSent = 0;
+    return true;
+}
+
+// Read, answer and write until the socket would block. Returns false once the connection
+// should be closed. Connections are edge-triggered, so this always drains what it can.
+bool serviceServerConnection(ServerConnection& c) {
+    char buffer[SERVER_READ_SIZE];
+    while (true) {
+        if (!flushServerOutput(c)) return false;
+        if (c.closing) return c.outputPending > 0;
+        if (c.outputPending > SERVER_MAX_PENDING_OUTPUT) return true; // wait for EPOLLOUT
+
+        ssize_t n = recv(c.fd, buffer, sizeof(buffer), 0);
+        if (n > 0) {
+            c.input.append(buffer, static_cast<size_t>(n));
+            handleServerInput(c);
+        } else if (n == 0) {
+            c.closing = true; // peer is done sending; finish replying, then close
+        } else if (errno == EINTR) {
+            continue;
+        } else {
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+    }
+}
+
+// One worker: accepts clients from the shared listening socket and serves them until stopped
+void runServerWorker(int listenFd) {
+    int epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (epollFd < 0) {
+        perror("epoll_create1");
+        return;
+    }
+
+    // Both shared descriptors are told apart from clients by their data pointers
+    static char listenTag, stopTag;
+    epoll_event ev{};
+    ev.events = EPOLLIN | EPOLLEXCLUSIVE;
+    ev.data.ptr = &listenTag;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, listenFd, &ev);
+    ev.events = EPOLLIN;
+    ev.data.ptr = &stopTag;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, serverStopFd, &ev);
 
-        // Print all days in the month
-        while (day <= daysInMonth[month]) {
-            cout << setw(3) << day << " ";
-            if ((startWeekday + day) % 7 == 0) {
-                cout << endl;
+    vector<unique_ptr<ServerConnection>> connections;
+    auto closeConnection = [&](ServerConnection* c) {
+        close(c->fd);
+        for (size_t i = 0; i < connections.size(); ++i) {
+            if (connections[i].get() == c) {
+                connections[i] = move(connections.back());
+                connections.pop_back();
+                break;
             }
-            ++day;
         }
-        cout << "\n";
+    };
+
+    epoll_event events[64];
+    bool running = true;
+    while (running) {
+        int ready = epoll_wait(epollFd, events, 64, -1);
+        if (ready < 0) {
+            if (errno == EINTR) continue;
+            perror("epoll_wait");
+            break;
+        }
+        for (int i = 0; i < ready; ++i) {
+            void* tag = events[i].data.ptr;
+            if (tag == &stopTag) {
+                running = false;
+            } else if (tag == &listenTag) {
+                while (true) {
+                    int fd = accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+                    if (fd < 0) break; // EAGAIN: another worker took it, or the backlog is empty
+                    int one = 1;
+                    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one)); // fails harmlessly on Unix sockets
+                    connections.push_back(make_unique<ServerConnection>());
+                    ServerConnection* c = connections.back().get();
+                    c->fd = fd;
+                    epoll_event client{};
+                    client.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+                    client.data.ptr = c;
+                    if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &client) < 0 || !serviceServerConnection(*c)) closeConnection(c);
+                }
+            } else {
+                ServerConnection* c = static_cast<ServerConnection*>(tag);
+                if ((events[i].events & EPOLLERR) || !serviceServerConnection(*c)) closeConnection(c);
+            }
+        }
+    }
+
+    for (unique_ptr<ServerConnection>& c : connections) close(c->fd);
+    close(epollFd);
+}
+
+enum class ServerSocketKind : unsigned char { Unix, Tcp };
+
+// Parse a TCP port (1-65535); rejects signs, junk and out-of-range values
+bool parsePort(const char* text, uint16_t& port) {
+    if (*text < '0' || *text > '9') return false;
+    char* end;
+    errno = 0;
+    unsigned long value = strtoul(text, &end, 10);
+    if (errno != 0 || *end != '\0' || value == 0 || value > 65535) return false;
+    port = static_cast<uint16_t>(value);
+    return true;
+}
+
+// Create the listening socket for a Unix socket path or a loopback "host:port"; -1 on error.
+// `kind` reports which one was opened, so only a Unix socket's path is removed at shutdown.
+int openServerSocket(const string& address, ServerSocketKind& kind) {
+    // "host:digits" or a loopback host with any port text is TCP; everything else is a path
+    size_t colon = address.rfind(':');
+    string host = colon != string::npos ? address.substr(0, colon) : string();
+    bool loopback = host == "127.0.0.1" || host == "localhost";
+    bool tcp = colon != string::npos && (loopback || (colon + 1 < address.size() &&
+               address.find_first_not_of("0123456789", colon + 1) == string::npos));
+    int fd;
+    if (tcp) {
+        kind = ServerSocketKind::Tcp;
+        if (!loopback) {
+            fprintf(stderr, "Only loopback addresses (127.0.0.1:PORT, localhost:PORT) are served\n");
+            return -1;
+        }
+        uint16_t port;
+        if (!parsePort(address.c_str() + colon + 1, port)) {
+            fprintf(stderr, "Invalid port '%s': expected 1 to 65535\n", address.c_str() + colon + 1);
+            return -1;
+        }
+        fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (fd < 0) return -1;
+        int one = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(port);
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if (bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+            perror("bind");
+            close(fd);
+            return -1;
+        }
+    } else {
+        kind = ServerSocketKind::Unix;
+        sockaddr_un addr{};
+        if (address.empty() || address.size() >= sizeof(addr.sun_path)) {
+            fprintf(stderr, "Invalid socket path %s\n", address.c_str());
+            return -1;
+        }
+        fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (fd < 0) return -1;
+        addr.sun_family = AF_UNIX;
+        memcpy(addr.sun_path, address.c_str(), address.size());
+        unlink(address.c_str()); // a stale socket from an earlier run
+        if (bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+            perror("bind");
+            close(fd);
+            return -1;
+        }
+    }
+    if (listen(fd, SOMAXCONN) < 0) {
+        perror("listen");
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// Parse a positive whole number of MiB into bytes; rejects signs, junk and overflow
+bool parseMebibytes(const char* text, size_t& bytes) {
+    if (*text < '0' || *text > '9') return false;
+    char* end;
+    errno = 0;
+    unsigned long long mebibytes = strtoull(text, &end, 10);
+    if (errno != 0 || *end != '\0' || mebibytes == 0 || mebibytes > (SIZE_MAX >> 20)) return false;
+    bytes = static_cast<size_t>(mebibytes) << 20;
+    return true;
+}
+
+// Entry point for "--serve ADDRESS [threads] [cache-MiB]"; runs until SIGINT or SIGTERM
+int runServer(const string& address, unsigned int threadCount, size_t cacheBytes) {
+    if (threadCount == 0) threadCount = 1;
+    if (!configureRenderCache(cacheBytes)) {
+        fprintf(stderr, "The render cache is already in use with a different size\n");
+        return 1;
+    }
+    ServerSocketKind socketKind;
+    int listenFd = openServerSocket(address, socketKind);
+    if (listenFd < 0) return 1;
+    serverStopFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (serverStopFd < 0) {
+        perror("eventfd");
+        return 1;
     }
+    signal(SIGINT, requestServerStop);
+    signal(SIGTERM, requestServerStop);
+    signal(SIGPIPE, SIG_IGN);
+
+    fprintf(stderr, "Serving on %s with %u threads\n", address.c_str(), threadCount);
+    vector<thread> workers;
+    for (unsigned int i = 0; i < threadCount; ++i) workers.emplace_back(runServerWorker, listenFd);
+    for (thread& t : workers) t.join();
+
+    RenderCacheStats stats = renderCache().stats();
+    uint64_t lookups = stats.hits + stats.misses;
+    fprintf(stderr, "Render cache: %llu hits, %llu misses (%.1f%% hit rate), %llu evictions, %zu entries, %zu bytes\n",
+            static_cast<unsigned long long>(stats.hits), static_cast<unsigned long long>(stats.misses),
+            lookups ? 100.0 * stats.hits / lookups : 0.0, static_cast<unsigned long long>(stats.evictions),
+            stats.entries, stats.bytes);
+
+    close(listenFd);
+    close(serverStopFd);
+    if (socketKind == ServerSocketKind::Unix) unlink(address.c_str());
+    return 0;
+}
+
+// ---------------------------------------------------------------------------------------
+// Command-line arguments
+// Numbers are parsed strictly: the whole argument must be a decimal number in range, and
+// anything else is a usage error rather than a silent 0.
+// ---------------------------------------------------------------------------------------
+
+// Year arguments stay inside the range the SIMD kernels handle (see MAX_KERNEL_JDN)
+const long MAX_ARGUMENT_YEAR = 5000000;
+const long MAX_ARGUMENT_THREADS = 1024;
+
+// Parse a whole decimal number in [minValue, maxValue]; rejects empty text, spaces, junk and overflow
+bool parseIntArgument(const char* text, long minValue, long maxValue, int& value) {
+    if (*text != '-' && (*text < '0' || *text > '9')) return false;
+    char* end;
+    errno = 0;
+    long parsed = strtol(text, &end, 10);
+    if (errno != 0 || *end != '\0' || parsed < minValue || parsed > maxValue) return false;
+    value = static_cast<int>(parsed);
+    return true;
 }
 
-// Main menu-driven program
-int main() {
+// Parse the "FROM TO" of a year-range mode, allowing at most `maxYears` years; explains any rejection
+bool parseYearRange(const char* fromText, const char* toText, int maxYears, int& firstYear, int& lastYear) {
+    if (!parseIntArgument(fromText, -MAX_ARGUMENT_YEAR, MAX_ARGUMENT_YEAR, firstYear) ||
+        !parseIntArgument(toText, -MAX_ARGUMENT_YEAR, MAX_ARGUMENT_YEAR, lastYear)) {
+        fprintf(stderr, "Invalid year range '%s' '%s': expected whole years between %ld and %ld\n",
+                fromText, toText, -MAX_ARGUMENT_YEAR, MAX_ARGUMENT_YEAR);
+        return false;
+    }
+    if (firstYear > lastYear) {
+        fprintf(stderr, "Invalid year range %d..%d: FROM is after TO\n", firstYear, lastYear);
+        return false;
+    }
+    if (lastYear - firstYear >= maxYears) {
+        fprintf(stderr, "Invalid year range %d..%d: at most %d years at a time\n", firstYear, lastYear, maxYears);
+        return false;
+    }
+    return true;
+}
+
+// Parse an explicit thread count (1 to MAX_ARGUMENT_THREADS)
+bool parseThreadCount(const char* text, unsigned int& threads) {
+    int count;
+    if (!parseIntArgument(text, 1, MAX_ARGUMENT_THREADS, count)) {
+        fprintf(stderr, "Invalid thread count '%s': expected 1 to %ld\n", text, MAX_ARGUMENT_THREADS);
+        return false;
+    }
+    threads = static_cast<unsigned int>(count);
+    return true;
+}
+
+int printUsage(const char* program) {
+    fprintf(stderr, "Usage: %s [--g2e|--e2g [file]]\n"
+                    "       %s --ethiopian-years|--gregorian-years FROM TO [threads]\n"
+                    "       %s --verify [FROM TO] [threads]\n"
+                    "       %s --serve SOCKET-PATH|127.0.0.1:PORT [threads] [cache-MiB]\n"
+                    "Any of these may be preceded by --stats or --stats=json.\n", program, program, program, program);
+    return 1;
+}
+
+#ifndef ETHIOCAL_NO_MAIN
+// Main menu-driven program (left out when the benchmark program compiles this file)
+// With "--g2e [file]" or "--e2g [file]" the program runs as a non-interactive batch converter;
+// "--ethiopian-years FROM TO" / "--gregorian-years FROM TO" render a range of years in parallel,
+// "--verify [FROM TO] [threads]" checks the engine day by day against a reference calendar,
+// and "--serve ADDRESS [threads] [cache-MiB]" runs the local server.
+// A leading "--stats" or "--stats=json" reports operation statistics on stderr at exit.
+int main(int argc, char* argv[]) {
+    // "--stats" / "--stats=json" may precede any mode and reports to stderr on exit
+    if (argc >= 2 && (string(argv[1]) == "--stats" || string(argv[1]) == "--stats=json")) {
+        statsExportAtExit = string(argv[1]) == "--stats" ? StatsExport::Prometheus : StatsExport::Json;
+        atexit(writeStatsAtExit);
+        argv[1] = argv[0];
+        --argc;
+        ++argv;
+    }
+
+    if (argc >= 2) {
+        string mode = argv[1];
+        if (mode == "--g2e" || mode == "--e2g") {
+            return runBatchMode(mode == "--g2e", argc >= 3 ? argv[2] : nullptr);
+        }
+        if ((mode == "--ethiopian-years" || mode == "--gregorian-years") && (argc == 4 || argc == 5)) {
+            int firstYear, lastYear;
+            unsigned int threads = thread::hardware_concurrency();
+            if (!parseYearRange(argv[2], argv[3], MAX_RENDER_YEARS, firstYear, lastYear) ||
+                (argc == 5 && !parseThreadCount(argv[4], threads))) {
+                return printUsage(argv[0]);
+            }
+            return runMultiYearRender(mode == "--ethiopian-years", firstYear, lastYear, threads);
+        }
+        if (mode == "--verify" && argc != 3 && argc <= 5) {
+            // FROM and TO come as a pair; without them the default range is checked
+            int firstYear = -50000, lastYear = 50000;
+            unsigned int threads = thread::hardware_concurrency();
+            if ((argc >= 4 && !parseYearRange(argv[2], argv[3], MAX_VERIFY_YEARS, firstYear, lastYear)) ||
+                (argc == 5 && !parseThreadCount(argv[4], threads))) {
+                return printUsage(argv[0]);
+            }
+            return runVerification(firstYear, lastYear, threads);
+        }
+        if (mode == "--serve" && argc >= 3 && argc <= 5) {
+            unsigned int threads = thread::hardware_concurrency();
+            if (argc >= 4 && !parseThreadCount(argv[3], threads)) return printUsage(argv[0]);
+            size_t cacheBytes = DEFAULT_RENDER_CACHE_BYTES;
+            if (argc >= 5 && !parseMebibytes(argv[4], cacheBytes)) {
+                fprintf(stderr, "Invalid cache size '%s': expected a whole number of MiB (1 or more)\n", argv[4]);
+                return 1;
+            }
+            return runServer(argv[2], threads, cacheBytes);
+        }
+        return printUsage(argv[0]);
+    }
+
     int choice;
     cout << "===== Calendar System =====\n";
     do {
@@ -322,3 +1738,4 @@ int main() {
 
     return 0;
 }
+#endif // ETHIOCAL_NO_MAIN
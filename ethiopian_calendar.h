@@ -0,0 +1,1879 @@
+/*
+==========================================================================================
+
+Library: Ethiopian and Gregorian Calendar Core
+
+Purpose:
+---------
+The calendar logic behind the "Ethiopian Calendar" program, as a header-only library that
+can be included from any C++20 translation unit. It covers:
+
+1. Conversion between Gregorian, Ethiopian and Julian Day Numbers (single dates, spans of
+   dates, and AVX2 / AVX-512 bulk kernels).
+2. Leap years, Amete Alem, Evangelist, new-year weekday and the Bahire Hasab.
+3. Fixed and movable Ethiopian holidays.
+4. Day ranges that walk Ethiopian and Gregorian dates in lockstep, and Ethiopian date
+   arithmetic (add days / months / years, differences).
+5. Unix timestamps to Ethiopian dates and Ethiopian clock hours at a fixed UTC offset.
+6. Parsing date strings (ISO, DD/MM/YYYY, Ethiopian month names), vectorised for bulk input.
+7. Formatting dates into caller buffers with compiled patterns (%Y-%m-%d, month and weekday
+   names, Amete Mihret / Amete Alem eras).
+8. Rendering of full Ethiopian and Gregorian year calendars into a caller-owned buffer.
+
+Everything here is reentrant: there is no global mutable state, nothing allocates, and no
+libc time functions (mktime, localtime, ...) are used, so the functions can be called from
+any number of threads without locking. All tables are constexpr and built at compile time.
+
+Everything is declared in namespace ethiocal; helpers and kernels that are not part of the
+interface live in ethiocal::detail.
+
+==========================================================================================
+*/
+
+#ifndef ETHIOPIAN_CALENDAR_H
+#define ETHIOPIAN_CALENDAR_H
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define ETHIOCAL_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
+namespace ethiocal {
+
+// Ethiopian calendar month names
+constexpr std::string_view months[13] = {
+    "Meskerem", "Tikimt", "Hidar", "Tahisas", "Tir", "Yekatit",
+    "Megabit", "Miyazia", "Ginbot", "Sene", "Hamle", "Nehase", "Pagume"
+};
+
+// Gregorian calendar month names
+constexpr std::string_view gregorianMonths[12] = {
+    "January", "February", "March", "April", "May", "June",
+    "July", "August", "September", "October", "November", "December"
+};
+
+// Weekday names starting from Monday
+constexpr std::string_view weekdays[7] = {"Mon", "Tue", "Wed", "Thu", "Fri", "Sat", "Sun"};
+
+// Day counts are 64-bit so every proleptic year, including years before 1, converts exactly
+using DayNumber = std::int64_t;
+
+namespace detail {
+
+// Division and remainder rounding towards negative infinity for a positive divisor (C++ '/'
+// and '%' truncate towards zero, which breaks cycle arithmetic for negative years and days).
+// Year arithmetic stays in 32 bits; only day counts need the 64-bit versions. Division by 4
+// is written as '>> 2' and '& 3', which C++20 defines as flooring for negative values.
+template <typename T>
+constexpr T floorDiv(T a, std::type_identity_t<T> b) {
+    T q = a / b;
+    return q - (q * b > a);
+}
+
+template <typename T>
+constexpr T floorMod(T a, std::type_identity_t<T> b) {
+    return a - b * floorDiv(a, b);
+}
+
+} // namespace detail
+
+// Function to check if an Ethiopian year is a leap year
+constexpr bool isLeapYear(int year) {
+    // In the Ethiopian calendar, a year is a leap year if it leaves remainder 3 when divided by 4
+    return (year & 3) == 3;
+}
+
+// Calculate the Ethiopian "Amete Alem" (year since creation of the world)
+constexpr int computeAmeteAlem(int year) {
+    return 5500 + year;
+}
+
+// Calculate Metene Rabiet (used to determine starting weekday)
+constexpr int computeMeteneRabiet(int amete_alem) {
+    return amete_alem >> 2;
+}
+
+// Determine the Evangelist name for the year
+constexpr std::string_view getEvangelist(int amete_alem) {
+    switch (amete_alem & 3) {
+        case 1: return "Mathewos";
+        case 2: return "Markos";
+        case 3: return "Lukas";
+        default: return "Yohannes";
+    }
+}
+
+// Find the start day of the Ethiopian year (1 Meskerem)
+// Returns day index: 0 = Monday, ..., 6 = Sunday
+constexpr int computeNewYearStartDay(int year) {
+    int amete_alem = computeAmeteAlem(year);
+    int metene_rabiet = computeMeteneRabiet(amete_alem);
+    return detail::floorMod(amete_alem + metene_rabiet, 7);
+}
+
+// Plain calendar dates used by the day-number engine
+struct GregorianDate {
+    int year, month, day;
+};
+
+struct EthiopianDate {
+    int year, month, day;
+};
+
+// Julian Day Number of 1 Meskerem 1 (start of the Amete Mihret era)
+constexpr DayNumber ETHIOPIAN_EPOCH_JDN = 1724221;
+
+// Julian Day Number of 1 March of (proleptic Gregorian) year 0, where 400-year eras begin
+constexpr DayNumber GREGORIAN_MARCH_EPOCH_JDN = 1721120;
+
+// Function to check if a Gregorian year is a leap year
+constexpr bool isGregorianLeapYear(int year) {
+    return (year % 4 == 0 && year % 100 != 0) || (year % 400 == 0);
+}
+
+// Number of days in a Gregorian month (month is 1-based)
+constexpr int GREGORIAN_DAYS_IN_MONTH[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+constexpr int gregorianDaysInMonth(int year, int month) {
+    return (month == 2 && isGregorianLeapYear(year)) ? 29 : GREGORIAN_DAYS_IN_MONTH[month - 1];
+}
+
+// Number of days in an Ethiopian month (month is 1-based, 13 = Pagume)
+constexpr int ethiopianDaysInMonth(int year, int month) {
+    return (month == 13) ? (isLeapYear(year) ? 6 : 5) : 30;
+}
+
+constexpr bool isValidGregorianDate(int year, int month, int day) {
+    return month >= 1 && month <= 12 && day >= 1 && day <= gregorianDaysInMonth(year, month);
+}
+
+constexpr bool isValidEthiopianDate(int year, int month, int day) {
+    return month >= 1 && month <= 13 && day >= 1 && day <= ethiopianDaysInMonth(year, month);
+}
+
+// Gregorian date -> Julian Day Number (integer arithmetic only, no libc time calls).
+// Years are counted from 1 March so the leap day ends the year, then split into 400-year eras.
+constexpr DayNumber gregorianToJdn(int year, int month, int day) {
+    int y = year - (month <= 2);
+    int era = detail::floorDiv(y, 400);
+    int yearOfEra = y - era * 400;                                    // [0, 399]
+    int dayOfYear = (153 * ((month + 9) % 12) + 2) / 5 + day - 1;     // [0, 365]
+    int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return GREGORIAN_MARCH_EPOCH_JDN + static_cast<DayNumber>(era) * 146097 + dayOfEra;
+}
+
+// Julian Day Number -> Gregorian date
+constexpr GregorianDate jdnToGregorian(DayNumber jdn) {
+    DayNumber z = jdn - GREGORIAN_MARCH_EPOCH_JDN;
+    DayNumber era = detail::floorDiv(z, 146097);
+    int dayOfEra = static_cast<int>(z - era * 146097);                // [0, 146096]
+    int yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    int dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    int mp = (5 * dayOfYear + 2) / 153;                               // 0 = March
+
+    GregorianDate g{};
+    g.day = dayOfYear - (153 * mp + 2) / 5 + 1;
+    g.month = mp < 10 ? mp + 3 : mp - 9;
+    g.year = static_cast<int>(yearOfEra + era * 400 + (g.month <= 2));
+    return g;
+}
+
+// Ethiopian date -> Julian Day Number
+// Every Ethiopian year is 12 x 30 days plus Pagume, and every fourth year (year % 4 == 3) is a leap year
+constexpr DayNumber ethiopianToJdn(int year, int month, int day) {
+    return ETHIOPIAN_EPOCH_JDN + 365 * (static_cast<DayNumber>(year) - 1) + (year >> 2) + 30 * (month - 1) + (day - 1);
+}
+
+// Julian Day Number -> Ethiopian date
+constexpr EthiopianDate jdnToEthiopian(DayNumber jdn) {
+    // Count from the start of (non-leap) year 0 so each 4-year cycle ends with its leap year
+    DayNumber n = jdn - ETHIOPIAN_EPOCH_JDN + 365;
+    DayNumber cycle = detail::floorDiv(n, 1461);    // complete 4-year cycles
+    int r = static_cast<int>(n - 1461 * cycle); // day within the cycle
+    int yearInCycle = r / 365;
+    if (yearInCycle == 4) yearInCycle = 3; // 6th day of Pagume in a leap year
+    int dayOfYear = r - 365 * yearInCycle;
+
+    EthiopianDate e{};
+    e.year = static_cast<int>(4 * cycle + yearInCycle);
+    e.month = dayOfYear / 30 + 1;
+    e.day = dayOfYear % 30 + 1;
+    return e;
+}
+
+// Weekday of a Julian Day Number: 0 = Monday, ..., 6 = Sunday
+constexpr int weekdayFromJdn(DayNumber jdn) {
+    return static_cast<int>(detail::floorMod(jdn, 7));
+}
+
+// ---------------------------------------------------------------------------------------
+// Bahire Hasab
+// The traditional computus for movable feasts. From Amete Alem we derive Wenber, Abekte and
+// Metqi, then Beale Metqi and its Tewsak, which give Mebaja Hamer: the start of Tsome Nenewe.
+// Every other movable feast is a fixed number of days after Tsome Nenewe.
+// ---------------------------------------------------------------------------------------
+
+struct BahireHasab {
+    int ameteAlem;
+    int wenber;
+    int abekte;
+    int metqi;
+    EthiopianDate bealeMetqi;
+    int tewsak;
+    EthiopianDate mebajaHamer; // Tsome Nenewe (Fast of Nineveh)
+};
+
+// Tewsak of Beale Metqi, indexed by its weekday (0 = Monday, ..., 6 = Sunday)
+constexpr int TEWSAK[7] = {6, 5, 4, 3, 2, 8, 7};
+
+constexpr BahireHasab computeBahireHasab(int year) {
+    BahireHasab b{};
+    b.ameteAlem = computeAmeteAlem(year);
+    b.wenber = detail::floorMod(b.ameteAlem - 1, 19); // Medeb - 1, wrapping 0 to 18
+    b.abekte = (b.wenber * 11) % 30;
+    b.metqi = (b.wenber * 19) % 30;
+    if (b.metqi == 0) b.metqi = 30;
+
+    // Beale Metqi falls in Meskerem when Metqi is past the 14th, otherwise in Tikimt
+    int bealeMetqiMonth = b.metqi > 14 ? 1 : 2;
+    b.bealeMetqi = EthiopianDate{year, bealeMetqiMonth, b.metqi};
+
+    int weekday = (computeNewYearStartDay(year) + (bealeMetqiMonth - 1) * 30 + b.metqi - 1) % 7;
+    b.tewsak = TEWSAK[weekday];
+
+    // Mebaja Hamer is Metqi + Tewsak days into Tir (after a Meskerem Metqi) or Yekatit
+    int month = bealeMetqiMonth == 1 ? 5 : 6;
+    int day = b.metqi + b.tewsak;
+    if (day > 30) {
+        day -= 30;
+        month++;
+    }
+    b.mebajaHamer = EthiopianDate{year, month, day};
+    return b;
+}
+
+// ---------------------------------------------------------------------------------------
+// Precomputed Ethiopian year table
+// Everything a renderer or converter needs about a year, built at compile time for the
+// years ETHIOCAL_TABLE_FIRST_YEAR..ETHIOCAL_TABLE_LAST_YEAR (override with -D).
+// ---------------------------------------------------------------------------------------
+
+#ifndef ETHIOCAL_TABLE_FIRST_YEAR
+#define ETHIOCAL_TABLE_FIRST_YEAR 1800
+#endif
+#ifndef ETHIOCAL_TABLE_LAST_YEAR
+#define ETHIOCAL_TABLE_LAST_YEAR 2300
+#endif
+
+struct EthiopianYearInfo {
+    DayNumber newYearJdn;    // JDN of 1 Meskerem
+    GregorianDate newYear;   // Gregorian date of 1 Meskerem
+    unsigned char startWeekday; // 0 = Monday, ..., 6 = Sunday
+    bool leap;               // Pagume has 6 days
+    short ninevehDayOfYear;  // 0-based day of year of Tsome Nenewe (Bahire Hasab)
+};
+
+constexpr EthiopianYearInfo computeYearInfo(int year) {
+    DayNumber jdn = ethiopianToJdn(year, 1, 1);
+    EthiopianDate nineveh = computeBahireHasab(year).mebajaHamer;
+    return EthiopianYearInfo{jdn, jdnToGregorian(jdn),
+                             static_cast<unsigned char>(computeNewYearStartDay(year)), isLeapYear(year),
+                             static_cast<short>((nineveh.month - 1) * 30 + nineveh.day - 1)};
+}
+
+constexpr int YEAR_TABLE_FIRST = ETHIOCAL_TABLE_FIRST_YEAR;
+constexpr int YEAR_TABLE_SIZE = ETHIOCAL_TABLE_LAST_YEAR - ETHIOCAL_TABLE_FIRST_YEAR + 1;
+
+constexpr std::array<EthiopianYearInfo, YEAR_TABLE_SIZE> buildYearTable() {
+    std::array<EthiopianYearInfo, YEAR_TABLE_SIZE> table{};
+    for (int i = 0; i < YEAR_TABLE_SIZE; ++i) table[i] = computeYearInfo(YEAR_TABLE_FIRST + i);
+    return table;
+}
+
+inline constexpr std::array<EthiopianYearInfo, YEAR_TABLE_SIZE> YEAR_TABLE = buildYearTable();
+
+// Year facts: a single indexed load inside the table range, computed otherwise
+constexpr EthiopianYearInfo ethiopianYearInfo(int year) {
+    unsigned int index = static_cast<unsigned int>(year - YEAR_TABLE_FIRST);
+    return index < static_cast<unsigned int>(YEAR_TABLE_SIZE) ? YEAR_TABLE[index] : computeYearInfo(year);
+}
+
+static_assert(computeNewYearStartDay(2017) == 2, "1 Meskerem 2017 is a Wednesday");
+static_assert(ethiopianToJdn(2017, 1, 1) == gregorianToJdn(2024, 9, 11), "Enkutatash 2017 is 11 September 2024");
+static_assert(ethiopianYearInfo(2016).newYear.day == 12, "a year following a leap year starts on 12 September");
+static_assert(isLeapYear(-1) && jdnToEthiopian(ethiopianToJdn(-1, 13, 6)).day == 6, "leap years continue before year 1");
+static_assert(jdnToGregorian(gregorianToJdn(-4713, 11, 24)).year == -4713 && gregorianToJdn(-4713, 11, 24) == 0,
+              "JDN 0 is 24 November 4714 BC (proleptic Gregorian)");
+static_assert(computeBahireHasab(2017).mebajaHamer.month == 6 && computeBahireHasab(2017).mebajaHamer.day == 3,
+              "Tsome Nenewe 2017 starts on Yekatit 3");
+
+// ---------------------------------------------------------------------------------------
+// Ethiopian holidays
+// Holidays are interned as HolidayId values with a static name table. Fixed-date holidays are
+// looked up through a compile-time (leap, month, day) table; movable feasts through their
+// offset from the year's Tsome Nenewe, taken from the year table. No lookup ever allocates.
+// ---------------------------------------------------------------------------------------
+
+// Values are fixed: the C ABI returns them (ETHIOCAL_HOLIDAY_* in ethiopian_calendar_c.h)
+enum class HolidayId : unsigned char {
+    None = 0,
+    Enkutatash = 1,
+    Meskel = 2,
+    Gena = 3,
+    Timket = 4,
+    Adwa = 5,
+    LabourDay = 6,
+    PatriotsDay = 7,
+    TsomeNenewe = 8,
+    AbiyTsom = 9,
+    DebreZeit = 10,
+    Hosanna = 11,
+    Siklet = 12,
+    Fasika = 13,
+    RikbeKahnat = 14,
+    Erget = 15,
+    Paraclete = 16,
+    TsomeHawariat = 17,
+    Count = 18
+};
+
+constexpr std::string_view HOLIDAY_NAMES[static_cast<int>(HolidayId::Count)] = {
+    "",
+    "Enkutatash (New Year)",
+    "Meskel",
+    "Gena (Christmas)",
+    "Timket (Epiphany)",
+    "Adwa (Adwa Victory Day)",
+    "Ye labaderoch Ken (Labour Day)",
+    "Ye Arbegnoch Ken (Patriots' Victory Day)",
+    "Tsome Nenewe (Fast of Nineveh)",
+    "Abiy Tsom (Great Lent)",
+    "Debre Zeit (Mid-Lent)",
+    "Hosanna (Palm Sunday)",
+    "Siklet (Good Friday)",
+    "Fasika (Easter)",
+    "Rikbe Kahnat",
+    "Erget (Ascension)",
+    "Paraclete (Pentecost)",
+    "Tsome Hawariat (Apostles' Fast)"
+};
+
+constexpr std::string_view holidayName(HolidayId id) {
+    return HOLIDAY_NAMES[static_cast<int>(id)];
+}
+
+// Holiday rules for fixed dates; Gena moves one day earlier in a leap year
+constexpr HolidayId fixedHolidayRule(bool isLeap, int month, int day) {
+    if (month == 1 && day == 1) return HolidayId::Enkutatash;
+    if (month == 1 && day == 17) return HolidayId::Meskel;
+    if (month == 4 && ((!isLeap && day == 29) || (isLeap && day == 28))) return HolidayId::Gena;
+    if (month == 5 && day == 11) return HolidayId::Timket;
+    if (month == 6 && day == 23) return HolidayId::Adwa;
+    if (month == 8 && day == 23) return HolidayId::LabourDay;
+    if (month == 8 && day == 27) return HolidayId::PatriotsDay;
+    return HolidayId::None;
+}
+
+struct HolidayTable {
+    HolidayId ids[2][14][31];     // [leap][month][day]
+    unsigned int masks[2][14];    // bit d set when day d of the month is a holiday
+};
+
+constexpr HolidayTable buildHolidayTable() {
+    HolidayTable table{};
+    for (int leap = 0; leap < 2; ++leap) {
+        for (int month = 1; month <= 13; ++month) {
+            for (int day = 1; day <= 30; ++day) {
+                HolidayId id = fixedHolidayRule(leap == 1, month, day);
+                table.ids[leap][month][day] = id;
+                if (id != HolidayId::None) table.masks[leap][month] |= 1u << day;
+            }
+        }
+    }
+    return table;
+}
+
+inline constexpr HolidayTable HOLIDAY_TABLE = buildHolidayTable();
+
+// Movable feasts and their distance in days from Tsome Nenewe
+struct MovableFeast {
+    HolidayId id;
+    int daysAfterNineveh;
+};
+
+constexpr MovableFeast MOVABLE_FEASTS[] = {
+    {HolidayId::TsomeNenewe, 0},
+    {HolidayId::AbiyTsom, 14},
+    {HolidayId::DebreZeit, 41},
+    {HolidayId::Hosanna, 62},
+    {HolidayId::Siklet, 67},
+    {HolidayId::Fasika, 69},
+    {HolidayId::RikbeKahnat, 93},
+    {HolidayId::Erget, 108},
+    {HolidayId::Paraclete, 118},
+    {HolidayId::TsomeHawariat, 119}
+};
+
+constexpr int MOVABLE_FEAST_SPAN = 120;
+
+constexpr std::array<HolidayId, MOVABLE_FEAST_SPAN> buildMovableFeastTable() {
+    std::array<HolidayId, MOVABLE_FEAST_SPAN> table{};
+    for (const MovableFeast& feast : MOVABLE_FEASTS) table[feast.daysAfterNineveh] = feast.id;
+    return table;
+}
+
+// Movable feast by days after Tsome Nenewe
+inline constexpr std::array<HolidayId, MOVABLE_FEAST_SPAN> MOVABLE_FEAST_BY_OFFSET = buildMovableFeastTable();
+
+// Date of a movable feast in the given Ethiopian year
+constexpr EthiopianDate getMovableFeastDate(int year, HolidayId feast) {
+    int dayOfYear = ethiopianYearInfo(year).ninevehDayOfYear;
+    for (const MovableFeast& f : MOVABLE_FEASTS) {
+        if (f.id == feast) dayOfYear += f.daysAfterNineveh;
+    }
+    return EthiopianDate{year, dayOfYear / 30 + 1, dayOfYear % 30 + 1};
+}
+
+// Fixed-date holiday on a given Ethiopian date, or HolidayId::None
+constexpr HolidayId getFixedHolidayId(int year, int month, int day) {
+    if (month < 1 || month > 13 || day < 1 || day > 30) return HolidayId::None;
+    return HOLIDAY_TABLE.ids[isLeapYear(year)][month][day];
+}
+
+// Movable feast on a given Ethiopian date, or HolidayId::None
+constexpr HolidayId getMovableFeastId(int year, int month, int day) {
+    if (month < 1 || month > 13 || day < 1 || day > 30) return HolidayId::None;
+    unsigned int offset = static_cast<unsigned int>((month - 1) * 30 + day - 1 - ethiopianYearInfo(year).ninevehDayOfYear);
+    return offset < static_cast<unsigned int>(MOVABLE_FEAST_SPAN) ? MOVABLE_FEAST_BY_OFFSET[offset] : HolidayId::None;
+}
+
+// Holidays on a given Ethiopian date. A movable feast can land on a fixed-date holiday
+// (Fasika on Labour Day or Patriots' Day), so both are reported; either may be None.
+struct EthiopianHolidays {
+    HolidayId fixed;
+    HolidayId movable;
+};
+
+constexpr EthiopianHolidays getEthiopianHolidays(int year, int month, int day) {
+    return EthiopianHolidays{getFixedHolidayId(year, month, day), getMovableFeastId(year, month, day)};
+}
+
+// Bitmap of the holiday days in an Ethiopian month (bit d = day d)
+constexpr unsigned int ethiopianHolidayMask(int year, int month) {
+    if (month < 1 || month > 13) return 0;
+    EthiopianYearInfo info = ethiopianYearInfo(year);
+    unsigned int mask = HOLIDAY_TABLE.masks[info.leap][month];
+    for (const MovableFeast& feast : MOVABLE_FEASTS) {
+        int dayOfYear = info.ninevehDayOfYear + feast.daysAfterNineveh;
+        if (dayOfYear / 30 + 1 == month) mask |= 1u << (dayOfYear % 30 + 1);
+    }
+    return mask;
+}
+
+// Names of the fixed-date holiday and the movable feast on a date, in that order
+// (an entry is empty when there is none)
+constexpr std::array<std::string_view, 2> getEthiopianHoliday(int year, int month, int day) {
+    EthiopianHolidays holidays = getEthiopianHolidays(year, month, day);
+    return {holidayName(holidays.fixed), holidayName(holidays.movable)};
+}
+
+static_assert(getEthiopianHolidays(2017, 4, 29).fixed == HolidayId::Gena, "Gena 2017 falls on Tahisas 29");
+static_assert(getEthiopianHolidays(2015, 4, 28).fixed == HolidayId::Gena, "Gena moves to Tahisas 28 in a leap year");
+static_assert(getEthiopianHolidays(2017, 8, 12).movable == HolidayId::Fasika, "Fasika 2017 is Miyazia 12 (20 April 2025)");
+static_assert(getEthiopianHolidays(2008, 8, 23).fixed == HolidayId::LabourDay &&
+              getEthiopianHolidays(2008, 8, 23).movable == HolidayId::Fasika,
+              "Fasika 2008 falls on Labour Day (1 May 2016)");
+
+// ---------------------------------------------------------------------------------------
+// Batch conversion API
+// These convert whole columns of dates into caller-provided arrays; nothing is printed and
+// nothing is allocated. `out` must be at least as long as `in`. Invalid input dates are
+// written as {0, 0, 0} and the number of invalid inputs is returned.
+// ---------------------------------------------------------------------------------------
+
+inline size_t convertGregorianToEthiopian(std::span<const GregorianDate> in, std::span<EthiopianDate> out) {
+    assert(out.size() >= in.size());
+    size_t invalid = 0;
+    for (size_t i = 0; i < in.size(); ++i) {
+        const GregorianDate& g = in[i];
+        if (isValidGregorianDate(g.year, g.month, g.day)) {
+            out[i] = jdnToEthiopian(gregorianToJdn(g.year, g.month, g.day));
+        } else {
+            out[i] = EthiopianDate{0, 0, 0};
+            ++invalid;
+        }
+    }
+    return invalid;
+}
+
+inline size_t convertEthiopianToGregorian(std::span<const EthiopianDate> in, std::span<GregorianDate> out) {
+    assert(out.size() >= in.size());
+    size_t invalid = 0;
+    for (size_t i = 0; i < in.size(); ++i) {
+        const EthiopianDate& e = in[i];
+        if (isValidEthiopianDate(e.year, e.month, e.day)) {
+            out[i] = jdnToGregorian(ethiopianToJdn(e.year, e.month, e.day));
+        } else {
+            out[i] = GregorianDate{0, 0, 0};
+            ++invalid;
+        }
+    }
+    return invalid;
+}
+
+// ---------------------------------------------------------------------------------------
+// Day ranges
+// DayRange walks consecutive days and keeps the Ethiopian date, the Gregorian date and the
+// weekday in step. Each ++ or -- only carries into the month and year when it has to, so
+// scanning decades of days costs a few compares per day rather than two full conversions.
+// ---------------------------------------------------------------------------------------
+
+// One day as seen by both calendars
+struct CalendarDay {
+    DayNumber jdn;
+    EthiopianDate ethiopian;
+    GregorianDate gregorian;
+    int weekday; // 0 = Monday, ..., 6 = Sunday
+};
+
+// Dereferencing returns the day by value: the day lives inside the iterator, and handing out
+// references to it would break std::reverse_iterator (which dereferences a temporary copy).
+class DayIterator {
+public:
+    using iterator_concept = std::bidirectional_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
+    using value_type = CalendarDay;
+    using difference_type = std::ptrdiff_t;
+    using reference = CalendarDay;
+
+    constexpr DayIterator() : day_{0, {0, 0, 0}, {0, 0, 0}, 0} {}
+
+    // The only place full conversions happen
+    constexpr explicit DayIterator(DayNumber jdn)
+        : day_{jdn, jdnToEthiopian(jdn), jdnToGregorian(jdn), weekdayFromJdn(jdn)} {}
+
+    constexpr CalendarDay operator*() const {
+        return day_;
+    }
+
+    constexpr DayIterator& operator++() {
+        ++day_.jdn;
+        day_.weekday = day_.weekday == 6 ? 0 : day_.weekday + 1;
+
+        EthiopianDate& e = day_.ethiopian;
+        if (e.day < 30 && (e.month < 13 || e.day < ethiopianDaysInMonth(e.year, 13))) {
+            ++e.day;
+        } else {
+            e.day = 1;
+            if (e.month == 13) {
+                e.month = 1;
+                ++e.year;
+            } else {
+                ++e.month;
+            }
+        }
+
+        GregorianDate& g = day_.gregorian;
+        if (g.day < 28 || g.day < gregorianDaysInMonth(g.year, g.month)) {
+            ++g.day;
+        } else {
+            g.day = 1;
+            if (g.month == 12) {
+                g.month = 1;
+                ++g.year;
+            } else {
+                ++g.month;
+            }
+        }
+        return *this;
+    }
+
+    constexpr DayIterator operator++(int) {
+        DayIterator before = *this;
+        ++*this;
+        return before;
+    }
+
+    constexpr DayIterator& operator--() {
+        --day_.jdn;
+        day_.weekday = day_.weekday == 0 ? 6 : day_.weekday - 1;
+
+        EthiopianDate& e = day_.ethiopian;
+        if (e.day > 1) {
+            --e.day;
+        } else if (e.month == 1) {
+            --e.year;
+            e.month = 13;
+            e.day = ethiopianDaysInMonth(e.year, 13);
+        } else {
+            --e.month;
+            e.day = 30;
+        }
+
+        GregorianDate& g = day_.gregorian;
+        if (g.day > 1) {
+            --g.day;
+        } else {
+            if (g.month == 1) {
+                --g.year;
+                g.month = 12;
+            } else {
+                --g.month;
+            }
+            g.day = gregorianDaysInMonth(g.year, g.month);
+        }
+        return *this;
+    }
+
+    constexpr DayIterator operator--(int) {
+        DayIterator before = *this;
+        --*this;
+        return before;
+    }
+
+    friend constexpr bool operator==(const DayIterator& a, const DayIterator& b) {
+        return a.day_.jdn == b.day_.jdn;
+    }
+
+private:
+    CalendarDay day_;
+};
+
+// The days [first, last) as a C++20 view
+class DayRange : public std::ranges::view_interface<DayRange> {
+public:
+    constexpr DayRange() = default;
+
+    constexpr DayRange(DayNumber firstJdn, DayNumber lastJdn)
+        : first_(firstJdn), last_(lastJdn < firstJdn ? firstJdn : lastJdn) {}
+
+    constexpr DayIterator begin() const {
+        return DayIterator(first_);
+    }
+
+    constexpr DayIterator end() const {
+        return DayIterator(last_);
+    }
+
+    constexpr size_t size() const {
+        return static_cast<size_t>(last_ - first_);
+    }
+
+private:
+    DayNumber first_ = 0;
+    DayNumber last_ = 0;
+};
+
+// Days from `first` up to, but not including, `last`
+constexpr DayRange ethiopianDays(const EthiopianDate& first, const EthiopianDate& last) {
+    return DayRange(ethiopianToJdn(first.year, first.month, first.day), ethiopianToJdn(last.year, last.month, last.day));
+}
+
+constexpr DayRange gregorianDays(const GregorianDate& first, const GregorianDate& last) {
+    return DayRange(gregorianToJdn(first.year, first.month, first.day), gregorianToJdn(last.year, last.month, last.day));
+}
+
+static_assert(std::ranges::bidirectional_range<DayRange> && std::ranges::view<DayRange> && std::ranges::sized_range<DayRange>,
+              "DayRange is a sized bidirectional view");
+static_assert([] {
+    // 5 Pagume 2016 (a common year) rolls over into 1 Meskerem 2017 = 11 September 2024
+    DayIterator it(ethiopianToJdn(2016, 13, 5));
+    ++it;
+    CalendarDay day = *it;
+    return day.ethiopian.year == 2017 && day.ethiopian.month == 1 && day.ethiopian.day == 1 &&
+           day.gregorian.month == 9 && day.gregorian.day == 11;
+}(), "Pagume carries into the next year");
+
+// ---------------------------------------------------------------------------------------
+// Date arithmetic
+// Ethiopian dates are twelve 30-day months plus Pagume, so months can be counted as
+// year * 13 + month and days come straight from the JDN engine: every operation here is a
+// handful of integer ops. Inputs must be valid dates. When the target month is shorter than
+// the day being kept (30 -> Pagume, or 6 Pagume -> a common year), the day is clamped to
+// the last day of that month. Month and year counts are 64-bit: year * 13 and the distance
+// between two int years do not fit in an int.
+// ---------------------------------------------------------------------------------------
+
+// Month ordinal of a date: 13 per year, so consecutive months differ by one
+constexpr std::int64_t ethiopianMonthIndex(const EthiopianDate& date) {
+    return static_cast<std::int64_t>(date.year) * 13 + (date.month - 1);
+}
+
+constexpr EthiopianDate addDays(const EthiopianDate& date, DayNumber days) {
+    return jdnToEthiopian(ethiopianToJdn(date.year, date.month, date.day) + days);
+}
+
+constexpr EthiopianDate addMonths(const EthiopianDate& date, std::int64_t count) {
+    std::int64_t index = ethiopianMonthIndex(date) + count;
+    std::int64_t year = detail::floorDiv(index, 13);
+    int month = static_cast<int>(index - year * 13) + 1;
+    int lastDay = ethiopianDaysInMonth(static_cast<int>(year), month);
+    return EthiopianDate{static_cast<int>(year), month, date.day < lastDay ? date.day : lastDay};
+}
+
+constexpr EthiopianDate addYears(const EthiopianDate& date, std::int64_t years) {
+    int year = static_cast<int>(date.year + years);
+    int lastDay = ethiopianDaysInMonth(year, date.month);
+    return EthiopianDate{year, date.month, date.day < lastDay ? date.day : lastDay};
+}
+
+// Signed number of days from `from` to `to`
+constexpr DayNumber daysBetween(const EthiopianDate& from, const EthiopianDate& to) {
+    return ethiopianToJdn(to.year, to.month, to.day) - ethiopianToJdn(from.year, from.month, from.day);
+}
+
+// Whole months from `from` to `to`: the largest n (towards zero) for which addMonths(from, n)
+// does not pass `to`
+constexpr std::int64_t monthsBetween(const EthiopianDate& from, const EthiopianDate& to) {
+    std::int64_t n = ethiopianMonthIndex(to) - ethiopianMonthIndex(from);
+    int landed = addMonths(from, n).day;
+    if (n > 0 && landed > to.day) --n;
+    else if (n < 0 && landed < to.day) ++n;
+    return n;
+}
+
+// Whole years from `from` to `to`, by the same rule
+constexpr std::int64_t yearsBetween(const EthiopianDate& from, const EthiopianDate& to) {
+    std::int64_t years = static_cast<std::int64_t>(to.year) - from.year;
+    EthiopianDate landed = addYears(from, years);
+    bool before = landed.month != to.month ? landed.month < to.month : landed.day < to.day;
+    bool after = landed.month != to.month ? landed.month > to.month : landed.day > to.day;
+    if (years > 0 && after) --years;
+    else if (years < 0 && before) ++years;
+    return years;
+}
+
+static_assert(addMonths(EthiopianDate{2016, 12, 30}, 1).day == 5, "30 Nehase + 1 month clamps to 5 Pagume");
+static_assert(addMonths(EthiopianDate{2015, 12, 30}, 1).day == 6, "Pagume has 6 days in a leap year");
+static_assert(addMonths(EthiopianDate{2016, 1, 10}, -1).year == 2015 && addMonths(EthiopianDate{2016, 1, 10}, -1).month == 13,
+              "months borrow across the year");
+static_assert(addYears(EthiopianDate{2015, 13, 6}, 1).day == 5, "6 Pagume clamps in a common year");
+static_assert(daysBetween(EthiopianDate{2016, 1, 1}, EthiopianDate{2017, 1, 1}) == 365, "2016 is a common year");
+static_assert(monthsBetween(EthiopianDate{2016, 1, 30}, EthiopianDate{2016, 3, 29}) == 1, "a month is not complete a day early");
+static_assert(monthsBetween(EthiopianDate{-2000000000, 1, 1}, EthiopianDate{2000000000, 1, 1}) == 52000000000,
+              "month counts span the whole int year range");
+
+// ---------------------------------------------------------------------------------------
+// Vectorised day-number kernels
+// The AVX2 / AVX-512 kernels convert 8 / 16 JDNs at a time using the same arithmetic as
+// jdnToEthiopian and jdnToGregorian. Large divisions go through double precision (exact for
+// int32 inputs); the small ones use multiply-shift constants that are exact for their
+// bounded operand ranges. The best kernel is chosen once at runtime from cpuid.
+// ---------------------------------------------------------------------------------------
+
+enum class SimdLevel { Scalar, Avx2, Avx512 };
+
+inline const char* simdLevelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::Avx512: return "avx512";
+        case SimdLevel::Avx2: return "avx2";
+        default: return "scalar";
+    }
+}
+
+inline SimdLevel detectSimdLevel() {
+#ifdef ETHIOCAL_X86_SIMD
+    __builtin_cpu_init();
+    // The AVX-512 kernels also use byte instructions (date parsing), so BW is required too
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) return SimdLevel::Avx512;
+    if (__builtin_cpu_supports("avx2")) return SimdLevel::Avx2;
+#endif
+    return SimdLevel::Scalar;
+}
+
+namespace detail {
+
+inline void jdnToEthiopianScalar(const int* jdns, EthiopianDate* out, size_t n) {
+    for (size_t i = 0; i < n; ++i) out[i] = jdnToEthiopian(jdns[i]);
+}
+
+inline void jdnToGregorianScalar(const int* jdns, GregorianDate* out, size_t n) {
+    for (size_t i = 0; i < n; ++i) out[i] = jdnToGregorian(jdns[i]);
+}
+
+#ifdef ETHIOCAL_X86_SIMD
+
+// floor(n / d) for 8 lanes; the reciprocal product can only be one too small, which is fixed up
+__attribute__((target("avx2")))
+inline __m256i floorDivAvx2(__m256i n, int d) {
+    const __m256d inv = _mm256_set1_pd(1.0 / d);
+    __m256d lo = _mm256_floor_pd(_mm256_mul_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(n)), inv));
+    __m256d hi = _mm256_floor_pd(_mm256_mul_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(n, 1)), inv));
+    __m256i q = _mm256_set_m128i(_mm256_cvttpd_epi32(hi), _mm256_cvttpd_epi32(lo));
+    __m256i r = _mm256_sub_epi32(n, _mm256_mullo_epi32(q, _mm256_set1_epi32(d)));
+    __m256i tooSmall = _mm256_cmpgt_epi32(r, _mm256_set1_epi32(d - 1));
+    return _mm256_sub_epi32(q, tooSmall); // mask lanes are -1
+}
+
+// (x * m) >> s for small non-negative x
+__attribute__((target("avx2")))
+inline __m256i mulShiftAvx2(__m256i x, int m, int s) {
+    return _mm256_srli_epi32(_mm256_mullo_epi32(x, _mm256_set1_epi32(m)), s);
+}
+
+__attribute__((target("avx2")))
+inline __m256i mulAvx2(__m256i x, int m) {
+    return _mm256_mullo_epi32(x, _mm256_set1_epi32(m));
+}
+
+__attribute__((target("avx2")))
+inline void jdnToEthiopianAvx2(const int* jdns, EthiopianDate* out, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i jdn = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(jdns + i));
+        __m256i days = _mm256_sub_epi32(jdn, _mm256_set1_epi32(static_cast<int>(ETHIOPIAN_EPOCH_JDN - 365)));
+        __m256i cycle = floorDivAvx2(days, 1461);
+        __m256i r = _mm256_sub_epi32(days, mulAvx2(cycle, 1461));
+        // Year within the cycle is min(r / 365, 3); the leap day (r == 1460) stays in year 3
+        __m256i yearInCycle = _mm256_sub_epi32(_mm256_setzero_si256(),
+            _mm256_add_epi32(_mm256_add_epi32(
+                _mm256_cmpgt_epi32(r, _mm256_set1_epi32(364)),
+                _mm256_cmpgt_epi32(r, _mm256_set1_epi32(729))),
+                _mm256_cmpgt_epi32(r, _mm256_set1_epi32(1094))));
+        __m256i dayOfYear = _mm256_sub_epi32(r, mulAvx2(yearInCycle, 365));
+        __m256i month0 = mulShiftAvx2(dayOfYear, 2185, 16); // dayOfYear / 30
+        __m256i year = _mm256_add_epi32(_mm256_slli_epi32(cycle, 2), yearInCycle);
+        __m256i day = _mm256_sub_epi32(dayOfYear, mulAvx2(month0, 30));
+
+        alignas(32) int y[8], m[8], d[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(y), year);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(m), month0);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(d), day);
+        for (int k = 0; k < 8; ++k) out[i + k] = EthiopianDate{y[k], m[k] + 1, d[k] + 1};
+    }
+    jdnToEthiopianScalar(jdns + i, out + i, n - i);
+}
+
+__attribute__((target("avx2")))
+inline void jdnToGregorianAvx2(const int* jdns, GregorianDate* out, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i jdn = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(jdns + i));
+        __m256i z = _mm256_sub_epi32(jdn, _mm256_set1_epi32(static_cast<int>(GREGORIAN_MARCH_EPOCH_JDN)));
+        __m256i era = floorDivAvx2(z, 146097);
+        __m256i doe = _mm256_sub_epi32(z, mulAvx2(era, 146097));           // [0, 146096]
+        __m256i c1 = floorDivAvx2(doe, 1460);
+        __m256i c2 = _mm256_sub_epi32(_mm256_setzero_si256(), _mm256_add_epi32(_mm256_add_epi32(
+            _mm256_cmpgt_epi32(doe, _mm256_set1_epi32(36523)),
+            _mm256_cmpgt_epi32(doe, _mm256_set1_epi32(73047))), _mm256_add_epi32(
+            _mm256_cmpgt_epi32(doe, _mm256_set1_epi32(109571)),
+            _mm256_cmpgt_epi32(doe, _mm256_set1_epi32(146095)))));            // doe / 36524
+        __m256i c3 = _mm256_srli_epi32(_mm256_cmpeq_epi32(doe, _mm256_set1_epi32(146096)), 31);
+        __m256i yoe = floorDivAvx2(_mm256_sub_epi32(_mm256_add_epi32(_mm256_sub_epi32(doe, c1), c2), c3), 365);
+        __m256i doy = _mm256_sub_epi32(doe, _mm256_sub_epi32(
+            _mm256_add_epi32(mulAvx2(yoe, 365), _mm256_srli_epi32(yoe, 2)),
+            mulShiftAvx2(yoe, 1311, 17)));                                  // yoe / 100
+        __m256i mp = mulShiftAvx2(_mm256_add_epi32(mulAvx2(doy, 5), _mm256_set1_epi32(2)), 6854, 20);
+        __m256i day = _mm256_add_epi32(_mm256_sub_epi32(doy,
+            mulShiftAvx2(_mm256_add_epi32(mulAvx2(mp, 153), _mm256_set1_epi32(2)), 13108, 16)),
+            _mm256_set1_epi32(1));
+        // mp counts months from March: 0..9 -> Mar..Dec, 10..11 -> Jan..Feb of the next year
+        __m256i janFeb = _mm256_cmpgt_epi32(mp, _mm256_set1_epi32(9));
+        __m256i month = _mm256_sub_epi32(_mm256_add_epi32(mp, _mm256_set1_epi32(3)),
+            _mm256_and_si256(janFeb, _mm256_set1_epi32(12)));
+        __m256i year = _mm256_sub_epi32(_mm256_add_epi32(yoe, mulAvx2(era, 400)), janFeb);
+
+        alignas(32) int y[8], m[8], d[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(y), year);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(m), month);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(d), day);
+        for (int k = 0; k < 8; ++k) out[i + k] = GregorianDate{y[k], m[k], d[k]};
+    }
+    jdnToGregorianScalar(jdns + i, out + i, n - i);
+}
+
+// The AVX-512 code uses the zero-masking (maskz) form of intrinsics whose plain form merges
+// into an undefined vector: the instructions are the same, but GCC 12 reports those
+// undefined vectors under -Wmaybe-uninitialized. Full masks keep every lane.
+
+// floor(n / d) for 16 lanes, as floorDivAvx2 does for 8
+__attribute__((target("avx512f")))
+inline __m512i floorDivAvx512(__m512i n, int d) {
+    const __m512d inv = _mm512_set1_pd(1.0 / d);
+    __m512d lo = _mm512_maskz_roundscale_pd(0xFF, _mm512_mul_pd(_mm512_maskz_cvtepi32_pd(0xFF, _mm512_maskz_extracti64x4_epi64(0xF, n, 0)), inv),
+                                            _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+    __m512d hi = _mm512_maskz_roundscale_pd(0xFF, _mm512_mul_pd(_mm512_maskz_cvtepi32_pd(0xFF, _mm512_maskz_extracti64x4_epi64(0xF, n, 1)), inv),
+                                            _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+    __m512i q = _mm512_maskz_inserti64x4(0xFF, _mm512_setzero_si512(), _mm512_maskz_cvttpd_epi32(0xFF, lo), 0);
+    q = _mm512_maskz_inserti64x4(0xFF, q, _mm512_maskz_cvttpd_epi32(0xFF, hi), 1);
+    __m512i r = _mm512_sub_epi32(n, _mm512_mullo_epi32(q, _mm512_set1_epi32(d)));
+    __mmask16 tooSmall = _mm512_cmpge_epi32_mask(r, _mm512_set1_epi32(d));
+    return _mm512_mask_add_epi32(q, tooSmall, q, _mm512_set1_epi32(1));
+}
+
+__attribute__((target("avx512f")))
+inline __m512i mulShiftAvx512(__m512i x, int m, int s) {
+    return _mm512_maskz_srli_epi32(0xFFFF, _mm512_mullo_epi32(x, _mm512_set1_epi32(m)), s);
+}
+
+__attribute__((target("avx512f")))
+inline __m512i mulAvx512(__m512i x, int m) {
+    return _mm512_mullo_epi32(x, _mm512_set1_epi32(m));
+}
+
+// Adds 1 to each lane whose mask bit is set
+__attribute__((target("avx512f")))
+inline __m512i addMaskAvx512(__m512i x, __mmask16 mask) {
+    return _mm512_mask_add_epi32(x, mask, x, _mm512_set1_epi32(1));
+}
+
+__attribute__((target("avx512f")))
+inline void jdnToEthiopianAvx512(const int* jdns, EthiopianDate* out, size_t n) {
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512i jdn = _mm512_loadu_si512(jdns + i);
+        __m512i days = _mm512_sub_epi32(jdn, _mm512_set1_epi32(static_cast<int>(ETHIOPIAN_EPOCH_JDN - 365)));
+        __m512i cycle = floorDivAvx512(days, 1461);
+        __m512i r = _mm512_sub_epi32(days, mulAvx512(cycle, 1461));
+        __m512i yearInCycle = _mm512_setzero_si512();
+        yearInCycle = addMaskAvx512(yearInCycle, _mm512_cmpge_epi32_mask(r, _mm512_set1_epi32(365)));
+        yearInCycle = addMaskAvx512(yearInCycle, _mm512_cmpge_epi32_mask(r, _mm512_set1_epi32(730)));
+        yearInCycle = addMaskAvx512(yearInCycle, _mm512_cmpge_epi32_mask(r, _mm512_set1_epi32(1095)));
+        __m512i dayOfYear = _mm512_sub_epi32(r, mulAvx512(yearInCycle, 365));
+        __m512i month0 = mulShiftAvx512(dayOfYear, 2185, 16);
+        __m512i year = _mm512_add_epi32(_mm512_maskz_slli_epi32(0xFFFF, cycle, 2), yearInCycle);
+        __m512i day = _mm512_sub_epi32(dayOfYear, mulAvx512(month0, 30));
+
+        alignas(64) int y[16], m[16], d[16];
+        _mm512_store_si512(y, year);
+        _mm512_store_si512(m, month0);
+        _mm512_store_si512(d, day);
+        for (int k = 0; k < 16; ++k) out[i + k] = EthiopianDate{y[k], m[k] + 1, d[k] + 1};
+    }
+    jdnToEthiopianScalar(jdns + i, out + i, n - i);
+}
+
+__attribute__((target("avx512f")))
+inline void jdnToGregorianAvx512(const int* jdns, GregorianDate* out, size_t n) {
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512i jdn = _mm512_loadu_si512(jdns + i);
+        __m512i z = _mm512_sub_epi32(jdn, _mm512_set1_epi32(static_cast<int>(GREGORIAN_MARCH_EPOCH_JDN)));
+        __m512i era = floorDivAvx512(z, 146097);
+        __m512i doe = _mm512_sub_epi32(z, mulAvx512(era, 146097));
+        __m512i c1 = floorDivAvx512(doe, 1460);
+        __m512i c2 = _mm512_setzero_si512();
+        c2 = addMaskAvx512(c2, _mm512_cmpge_epi32_mask(doe, _mm512_set1_epi32(36524)));
+        c2 = addMaskAvx512(c2, _mm512_cmpge_epi32_mask(doe, _mm512_set1_epi32(73048)));
+        c2 = addMaskAvx512(c2, _mm512_cmpge_epi32_mask(doe, _mm512_set1_epi32(109572)));
+        c2 = addMaskAvx512(c2, _mm512_cmpge_epi32_mask(doe, _mm512_set1_epi32(146096)));
+        __m512i c3 = addMaskAvx512(_mm512_setzero_si512(), _mm512_cmpeq_epi32_mask(doe, _mm512_set1_epi32(146096)));
+        __m512i yoe = floorDivAvx512(_mm512_sub_epi32(_mm512_add_epi32(_mm512_sub_epi32(doe, c1), c2), c3), 365);
+        __m512i doy = _mm512_sub_epi32(doe, _mm512_sub_epi32(
+            _mm512_add_epi32(mulAvx512(yoe, 365), _mm512_maskz_srli_epi32(0xFFFF, yoe, 2)),
+            mulShiftAvx512(yoe, 1311, 17)));
+        __m512i mp = mulShiftAvx512(_mm512_add_epi32(mulAvx512(doy, 5), _mm512_set1_epi32(2)), 6854, 20);
+        __m512i day = _mm512_add_epi32(_mm512_sub_epi32(doy,
+            mulShiftAvx512(_mm512_add_epi32(mulAvx512(mp, 153), _mm512_set1_epi32(2)), 13108, 16)),
+            _mm512_set1_epi32(1));
+        __mmask16 janFeb = _mm512_cmpgt_epi32_mask(mp, _mm512_set1_epi32(9));
+        __m512i month = _mm512_mask_sub_epi32(_mm512_add_epi32(mp, _mm512_set1_epi32(3)),
+            janFeb, _mm512_add_epi32(mp, _mm512_set1_epi32(3)), _mm512_set1_epi32(12));
+        __m512i year = addMaskAvx512(_mm512_add_epi32(yoe, mulAvx512(era, 400)), janFeb);
+
+        alignas(64) int y[16], m[16], d[16];
+        _mm512_store_si512(y, year);
+        _mm512_store_si512(m, month);
+        _mm512_store_si512(d, day);
+        for (int k = 0; k < 16; ++k) out[i + k] = GregorianDate{y[k], m[k], d[k]};
+    }
+    jdnToGregorianScalar(jdns + i, out + i, n - i);
+}
+
+#endif // ETHIOCAL_X86_SIMD
+
+} // namespace detail
+
+// Day-number columns (e.g. dates already stored as JDN) need no validation.
+// These run the widest kernel the CPU supports unless a level is given explicitly.
+// Columns hold 32-bit JDNs, but the kernels subtract an epoch before dividing, so values
+// near INT32_MIN wrap: only |jdn| <= MAX_KERNEL_JDN (about years -5.48 million to +5.47
+// million) is supported. Use the DayNumber functions above for anything wider.
+constexpr DayNumber MAX_KERNEL_JDN = 2000000000;
+
+constexpr bool isKernelJdn(DayNumber jdn) {
+    return jdn >= -MAX_KERNEL_JDN && jdn <= MAX_KERNEL_JDN;
+}
+
+inline void jdnToEthiopian(std::span<const int> jdns, std::span<EthiopianDate> out, SimdLevel level) {
+    assert(out.size() >= jdns.size());
+#ifdef ETHIOCAL_X86_SIMD
+    if (level == SimdLevel::Avx512) return detail::jdnToEthiopianAvx512(jdns.data(), out.data(), jdns.size());
+    if (level == SimdLevel::Avx2) return detail::jdnToEthiopianAvx2(jdns.data(), out.data(), jdns.size());
+#endif
+    detail::jdnToEthiopianScalar(jdns.data(), out.data(), jdns.size());
+}
+
+inline void jdnToGregorian(std::span<const int> jdns, std::span<GregorianDate> out, SimdLevel level) {
+    assert(out.size() >= jdns.size());
+#ifdef ETHIOCAL_X86_SIMD
+    if (level == SimdLevel::Avx512) return detail::jdnToGregorianAvx512(jdns.data(), out.data(), jdns.size());
+    if (level == SimdLevel::Avx2) return detail::jdnToGregorianAvx2(jdns.data(), out.data(), jdns.size());
+#endif
+    detail::jdnToGregorianScalar(jdns.data(), out.data(), jdns.size());
+}
+
+inline void jdnToEthiopian(std::span<const int> jdns, std::span<EthiopianDate> out) {
+    static const SimdLevel level = detectSimdLevel();
+    jdnToEthiopian(jdns, out, level);
+}
+
+inline void jdnToGregorian(std::span<const int> jdns, std::span<GregorianDate> out) {
+    static const SimdLevel level = detectSimdLevel();
+    jdnToGregorian(jdns, out, level);
+}
+
+// ---------------------------------------------------------------------------------------
+// Timestamps and Ethiopian time
+// Unix timestamps become Ethiopian dates at a fixed UTC offset without localtime(): the
+// offset is added, the Ethiopian day is counted from 6 AM local time (so the hours between
+// midnight and 6 AM still belong to the previous date), and the day numbers go through the
+// bulk JDN kernels. Dates therefore follow the same leap rule as isLeapYear().
+// ---------------------------------------------------------------------------------------
+
+// Julian Day Number of 1 January 1970, the Unix epoch
+constexpr DayNumber UNIX_EPOCH_JDN = 2440588;
+
+// The Ethiopian day starts six hours after local midnight
+constexpr int ETHIOPIAN_DAY_START_SECONDS = 6 * 3600;
+
+// An Ethiopian date with the time of day on the Ethiopian clock. `hour` counts from 6 AM:
+// 0..11 are the daytime hours and 12..23 the night hours. A clock face shows
+// ethiopianClockHour(hour), so 7 AM local time is 1 o'clock in the day.
+struct EthiopianDateTime {
+    EthiopianDate date;
+    int hour, minute, second, millisecond;
+};
+
+// 1..12 as read on an Ethiopian clock (hour 0, i.e. 6 AM, reads 12)
+constexpr int ethiopianClockHour(int hour) {
+    int h = hour % 12;
+    return h == 0 ? 12 : h;
+}
+
+constexpr bool isEthiopianNightHour(int hour) {
+    return hour >= 12;
+}
+
+// Scalar conversion of one timestamp given in milliseconds
+constexpr EthiopianDateTime epochMillisecondsToEthiopian(std::int64_t milliseconds, int utcOffsetSeconds) {
+    std::int64_t local = milliseconds + (static_cast<std::int64_t>(utcOffsetSeconds) - ETHIOPIAN_DAY_START_SECONDS) * 1000;
+    std::int64_t days = detail::floorDiv(local, 86400000);
+    int msOfDay = static_cast<int>(local - days * 86400000);
+    return EthiopianDateTime{jdnToEthiopian(UNIX_EPOCH_JDN + days), msOfDay / 3600000, msOfDay / 60000 % 60,
+                             msOfDay / 1000 % 60, msOfDay % 1000};
+}
+
+constexpr EthiopianDateTime epochSecondsToEthiopian(std::int64_t seconds, int utcOffsetSeconds) {
+    std::int64_t local = seconds + utcOffsetSeconds - ETHIOPIAN_DAY_START_SECONDS;
+    std::int64_t days = detail::floorDiv(local, 86400);
+    int secondOfDay = static_cast<int>(local - days * 86400);
+    return EthiopianDateTime{jdnToEthiopian(UNIX_EPOCH_JDN + days), secondOfDay / 3600, secondOfDay / 60 % 60,
+                             secondOfDay % 60, 0};
+}
+
+namespace detail {
+
+// Bulk conversion of epoch timestamps (SCALE = units per second: 1 or 1000; a constant so the
+// divisions become multiplications). Times of day are split off per row, then blocks of day
+// numbers are converted by the widest kernel.
+template <std::int64_t SCALE>
+inline void epochToEthiopianBulk(std::span<const std::int64_t> stamps, int utcOffsetSeconds, std::span<EthiopianDateTime> out) {
+    assert(out.size() >= stamps.size());
+    constexpr size_t BLOCK = 256;
+    constexpr std::int64_t unitsPerDay = 86400 * SCALE;
+    const std::int64_t shift = (static_cast<std::int64_t>(utcOffsetSeconds) - ETHIOPIAN_DAY_START_SECONDS) * SCALE;
+    int jdns[BLOCK];
+    EthiopianDate dates[BLOCK];
+
+    for (size_t base = 0; base < stamps.size(); base += BLOCK) {
+        size_t count = stamps.size() - base < BLOCK ? stamps.size() - base : BLOCK;
+        bool inRange = true;
+        for (size_t i = 0; i < count; ++i) {
+            std::int64_t local = stamps[base + i] + shift;
+            std::int64_t days = floorDiv(local, unitsPerDay);
+            // The time of day is non-negative and small, so the rest is cheap 32-bit math
+            unsigned int unitOfDay = static_cast<unsigned int>(local - days * unitsPerDay);
+            unsigned int secondOfDay = unitOfDay / SCALE;
+            EthiopianDateTime& t = out[base + i];
+            t.hour = static_cast<int>(secondOfDay / 3600);
+            t.minute = static_cast<int>(secondOfDay / 60 % 60);
+            t.second = static_cast<int>(secondOfDay % 60);
+            t.millisecond = static_cast<int>((unitOfDay - secondOfDay * SCALE) * 1000 / SCALE);
+            std::int64_t jdn = UNIX_EPOCH_JDN + days;
+            inRange &= isKernelJdn(jdn);
+            jdns[i] = static_cast<int>(jdn);
+        }
+        if (inRange) {
+            jdnToEthiopian(std::span<const int>(jdns, count), std::span<EthiopianDate>(dates, count));
+            for (size_t i = 0; i < count; ++i) out[base + i].date = dates[i];
+        } else {
+            for (size_t i = 0; i < count; ++i) {
+                std::int64_t local = stamps[base + i] + shift;
+                out[base + i].date = jdnToEthiopian(UNIX_EPOCH_JDN + floorDiv(local, unitsPerDay));
+            }
+        }
+    }
+}
+
+} // namespace detail
+
+inline void epochSecondsToEthiopian(std::span<const std::int64_t> seconds, int utcOffsetSeconds,
+                                    std::span<EthiopianDateTime> out) {
+    detail::epochToEthiopianBulk<1>(seconds, utcOffsetSeconds, out);
+}
+
+inline void epochMillisecondsToEthiopian(std::span<const std::int64_t> milliseconds, int utcOffsetSeconds,
+                                         std::span<EthiopianDateTime> out) {
+    detail::epochToEthiopianBulk<1000>(milliseconds, utcOffsetSeconds, out);
+}
+
+// 11 September 2024 00:00 UTC is 03:00 in Addis Ababa (UTC+3): still the night of 5 Pagume 2016
+static_assert(epochSecondsToEthiopian(1726012800, 3 * 3600).date.day == 5 &&
+              epochSecondsToEthiopian(1726012800, 3 * 3600).hour == 21, "the Ethiopian day starts at 6 AM");
+static_assert(ethiopianClockHour(epochSecondsToEthiopian(1726027200, 3 * 3600).hour) == 1, "7 AM is 1 o'clock");
+
+// ---------------------------------------------------------------------------------------
+// Date parsing
+// Parses rows such as "2024-09-11", "11/09/2024" or "Meskerem 17 2017" without exceptions;
+// every row gets a ParseStatus. Fixed-width ISO and DD/MM/YYYY rows are checked and decoded
+// 16 at a time: each row occupies one 128-bit lane, where a byte compare validates the
+// digit/separator layout and a shuffle + multiply-add turns the digits into numbers. Rows
+// the vector path cannot take (other widths, signs, bad layout) go through the scalar parser,
+// so both paths always agree.
+// ---------------------------------------------------------------------------------------
+
+enum class DateFormat {
+    Iso,                // YYYY-MM-DD (the year may carry a sign or more digits)
+    DayMonthYear,       // DD/MM/YYYY
+    EthiopianMonthName  // "Meskerem 17 2017", month names from months[]
+};
+
+enum class ParseStatus : unsigned char {
+    Ok,
+    Malformed,   // text does not match the format
+    InvalidDate  // well formed, but not a date in the requested calendar
+};
+
+struct ParsedDate {
+    int year, month, day;
+    ParseStatus status;
+};
+
+namespace detail {
+
+// Parse 1..maxDigits decimal digits at p; returns the position after them, or nullptr
+constexpr const char* parseDigits(const char* p, const char* end, int maxDigits, int& value) {
+    int n = 0;
+    value = 0;
+    while (p < end && n < maxDigits && *p >= '0' && *p <= '9') {
+        value = value * 10 + (*p++ - '0');
+        ++n;
+    }
+    if (n == 0 || (p < end && *p >= '0' && *p <= '9')) return nullptr;
+    return p;
+}
+
+// Year with an optional leading '-'
+constexpr const char* parseYear(const char* p, const char* end, int& year) {
+    bool negative = p < end && *p == '-';
+    if (negative) ++p;
+    p = parseDigits(p, end, 9, year);
+    if (negative) year = -year;
+    return p;
+}
+
+constexpr char asciiLower(char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+// Ethiopian month number (1..13) for a case-insensitive name from months[], or 0
+constexpr int ethiopianMonthFromName(std::string_view name) {
+    for (int m = 0; m < 13; ++m) {
+        if (months[m].size() != name.size()) continue;
+        size_t i = 0;
+        while (i < name.size() && asciiLower(name[i]) == asciiLower(months[m][i])) ++i;
+        if (i == name.size()) return m + 1;
+    }
+    return 0;
+}
+
+constexpr ParsedDate finishParsedDate(int year, int month, int day, bool ethiopian) {
+    bool valid = ethiopian ? isValidEthiopianDate(year, month, day) : isValidGregorianDate(year, month, day);
+    return ParsedDate{year, month, day, valid ? ParseStatus::Ok : ParseStatus::InvalidDate};
+}
+
+} // namespace detail
+
+// Parse one row; surrounding spaces, tabs and '\r' are ignored. `ethiopian` selects the
+// calendar used to validate numeric formats (month-name rows are always Ethiopian).
+constexpr ParsedDate parseDate(std::string_view text, DateFormat format, bool ethiopian) {
+    const ParsedDate malformed{0, 0, 0, ParseStatus::Malformed};
+    const char* p = text.data();
+    const char* end = p + text.size();
+    while (p < end && (*p == ' ' || *p == '\t')) ++p;
+    while (end > p && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '\r')) --end;
+
+    int year = 0, month = 0, day = 0;
+    switch (format) {
+        case DateFormat::Iso:
+            if (!(p = detail::parseYear(p, end, year)) || p == end || *p++ != '-') return malformed;
+            if (!(p = detail::parseDigits(p, end, 2, month)) || p == end || *p++ != '-') return malformed;
+            if (!(p = detail::parseDigits(p, end, 2, day))) return malformed;
+            break;
+        case DateFormat::DayMonthYear:
+            if (!(p = detail::parseDigits(p, end, 2, day)) || p == end || *p++ != '/') return malformed;
+            if (!(p = detail::parseDigits(p, end, 2, month)) || p == end || *p++ != '/') return malformed;
+            if (!(p = detail::parseYear(p, end, year))) return malformed;
+            break;
+        case DateFormat::EthiopianMonthName: {
+            const char* name = p;
+            while (p < end && detail::asciiLower(*p) >= 'a' && detail::asciiLower(*p) <= 'z') ++p;
+            month = detail::ethiopianMonthFromName(std::string_view(name, p - name));
+            if (month == 0 || p == end || *p != ' ') return malformed;
+            while (p < end && *p == ' ') ++p;
+            if (!(p = detail::parseDigits(p, end, 2, day))) return malformed;
+            if (p < end && *p == ',') ++p;
+            if (p == end || *p != ' ') return malformed;
+            while (p < end && *p == ' ') ++p;
+            if (!(p = detail::parseYear(p, end, year))) return malformed;
+            ethiopian = true;
+            break;
+        }
+    }
+    if (p != end) return malformed;
+    return detail::finishParsedDate(year, month, day, ethiopian);
+}
+
+namespace detail {
+
+#ifdef ETHIOCAL_X86_SIMD
+
+// Layout of a fixed-width numeric row inside its 16-byte lane
+struct FixedDateLayout {
+    unsigned int digitBits;     // byte positions holding digits
+    unsigned int separatorBits; // byte positions holding the separator
+    char separator;
+    char gather[16];            // pshufb pattern moving digits to Y Y Y Y M M D D order
+};
+
+constexpr FixedDateLayout ISO_LAYOUT = {
+    0x36F, 0x090, '-', {0, 1, 2, 3, 5, 6, 8, 9, -1, -1, -1, -1, -1, -1, -1, -1}};
+constexpr FixedDateLayout DAY_MONTH_YEAR_LAYOUT = {
+    0x3DB, 0x024, '/', {6, 7, 8, 9, 3, 4, 0, 1, -1, -1, -1, -1, -1, -1, -1, -1}};
+
+// Copy the 10-character rows of a block into 16-byte lanes; rows of any other width are
+// zeroed so they fail the layout check and fall back to the scalar parser
+inline void stageFixedRows(const std::string_view* rows, size_t count, char (*lanes)[16]) {
+    for (size_t k = 0; k < count; ++k) {
+        std::memset(lanes[k], 0, 16);
+        if (rows[k].size() == 10) std::memcpy(lanes[k], rows[k].data(), 10);
+    }
+}
+
+// Decode the YYYY MM DD pairs of one lane once its layout has been validated
+inline void decodeFixedLane(const short* pairs, int& year, int& month, int& day) {
+    year = pairs[0] * 100 + pairs[1];
+    month = pairs[2];
+    day = pairs[3];
+}
+
+__attribute__((target("avx2")))
+inline void parseFixedDatesAvx2(const std::string_view* rows, size_t count, const FixedDateLayout& layout,
+                                bool ethiopian, DateFormat format, ParsedDate* out) {
+    alignas(32) char lanes[16][16] = {};
+    alignas(32) short pairs[16][8];
+    const __m256i zero = _mm256_set1_epi8('0');
+    const __m256i nine = _mm256_set1_epi8(9);
+    const __m256i separator = _mm256_set1_epi8(layout.separator);
+    const __m256i gather = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(layout.gather)));
+    const __m256i weights = _mm256_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+                                             10, 1, 10, 1, 10, 1, 10, 1, 0, 0, 0, 0, 0, 0, 0, 0);
+
+    for (size_t base = 0; base < count; base += 16) {
+        size_t block = count - base < 16 ? count - base : 16;
+        stageFixedRows(rows + base, block, lanes);
+        unsigned int laneOk = 0;
+        for (size_t k = 0; k < block; k += 2) {
+            __m256i v = _mm256_load_si256(reinterpret_cast<const __m256i*>(lanes[k]));
+            __m256i d = _mm256_sub_epi8(v, zero);
+            unsigned int digits = static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_min_epu8(d, nine), d)));
+            unsigned int seps = static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, separator)));
+            for (int half = 0; half < 2; ++half) {
+                unsigned int dm = (digits >> (16 * half)) & 0x3FF, sm = (seps >> (16 * half)) & 0x3FF;
+                if (dm == layout.digitBits && sm == layout.separatorBits) laneOk |= 1u << (k + half);
+            }
+            __m256i values = _mm256_maddubs_epi16(_mm256_shuffle_epi8(d, gather), weights);
+            // Pairs of lanes land in pairs[k] and pairs[k + 1]
+            _mm256_store_si256(reinterpret_cast<__m256i*>(pairs[k]), values);
+        }
+        for (size_t k = 0; k < block; ++k) {
+            if (laneOk & (1u << k)) {
+                int year, month, day;
+                decodeFixedLane(pairs[k], year, month, day);
+                out[base + k] = finishParsedDate(year, month, day, ethiopian);
+            } else {
+                out[base + k] = parseDate(rows[base + k], format, ethiopian);
+            }
+        }
+    }
+}
+
+__attribute__((target("avx512f,avx512bw")))
+inline void parseFixedDatesAvx512(const std::string_view* rows, size_t count, const FixedDateLayout& layout,
+                                  bool ethiopian, DateFormat format, ParsedDate* out) {
+    alignas(64) char lanes[16][16] = {};
+    alignas(64) short pairs[16][8];
+    const __m512i zero = _mm512_set1_epi8('0');
+    const __m512i nine = _mm512_set1_epi8(9);
+    const __m512i separator = _mm512_set1_epi8(layout.separator);
+    const __m512i gather = _mm512_maskz_broadcast_i32x4(0xFFFF, _mm_loadu_si128(reinterpret_cast<const __m128i*>(layout.gather)));
+    const __m512i weights = _mm512_maskz_broadcast_i32x4(0xFFFF, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 0, 0, 0, 0, 0, 0, 0, 0));
+
+    for (size_t base = 0; base < count; base += 16) {
+        size_t block = count - base < 16 ? count - base : 16;
+        stageFixedRows(rows + base, block, lanes);
+        unsigned int laneOk = 0;
+        for (size_t k = 0; k < block; k += 4) {
+            __m512i v = _mm512_load_si512(lanes[k]);
+            __m512i d = _mm512_sub_epi8(v, zero);
+            unsigned long long digits = _mm512_cmple_epu8_mask(d, nine);
+            unsigned long long seps = _mm512_cmpeq_epi8_mask(v, separator);
+            for (int lane = 0; lane < 4; ++lane) {
+                unsigned int dm = (digits >> (16 * lane)) & 0x3FF, sm = (seps >> (16 * lane)) & 0x3FF;
+                if (dm == layout.digitBits && sm == layout.separatorBits) laneOk |= 1u << (k + lane);
+            }
+            __m512i values = _mm512_maddubs_epi16(_mm512_shuffle_epi8(d, gather), weights);
+            _mm512_store_si512(pairs[k], values);
+        }
+        for (size_t k = 0; k < block; ++k) {
+            if (laneOk & (1u << k)) {
+                int year, month, day;
+                decodeFixedLane(pairs[k], year, month, day);
+                out[base + k] = finishParsedDate(year, month, day, ethiopian);
+            } else {
+                out[base + k] = parseDate(rows[base + k], format, ethiopian);
+            }
+        }
+    }
+}
+
+#endif // ETHIOCAL_X86_SIMD
+
+} // namespace detail
+
+// Parse a column of rows into `out` (at least as long as `rows`); returns the number of rows
+// whose status is not Ok. Malformed rows never stop the batch.
+inline size_t parseDates(std::span<const std::string_view> rows, DateFormat format, bool ethiopian,
+                         std::span<ParsedDate> out, SimdLevel level) {
+    assert(out.size() >= rows.size());
+#ifdef ETHIOCAL_X86_SIMD
+    if (format != DateFormat::EthiopianMonthName && level != SimdLevel::Scalar) {
+        const detail::FixedDateLayout& layout = format == DateFormat::Iso ? detail::ISO_LAYOUT : detail::DAY_MONTH_YEAR_LAYOUT;
+        if (level == SimdLevel::Avx512) detail::parseFixedDatesAvx512(rows.data(), rows.size(), layout, ethiopian, format, out.data());
+        else detail::parseFixedDatesAvx2(rows.data(), rows.size(), layout, ethiopian, format, out.data());
+    } else
+#endif
+    {
+        for (size_t i = 0; i < rows.size(); ++i) out[i] = parseDate(rows[i], format, ethiopian);
+    }
+
+    size_t failed = 0;
+    for (size_t i = 0; i < rows.size(); ++i) failed += out[i].status != ParseStatus::Ok;
+    return failed;
+}
+
+inline size_t parseDates(std::span<const std::string_view> rows, DateFormat format, bool ethiopian,
+                         std::span<ParsedDate> out) {
+    static const SimdLevel level = detectSimdLevel();
+    return parseDates(rows, format, ethiopian, out, level);
+}
+
+static_assert(parseDate("2024-09-11", DateFormat::Iso, false).day == 11, "ISO dates parse");
+static_assert(parseDate("Meskerem 17 2017", DateFormat::EthiopianMonthName, true).month == 1, "month names parse");
+static_assert(parseDate("31/02/2024", DateFormat::DayMonthYear, false).status == ParseStatus::InvalidDate,
+              "impossible dates are reported, not thrown");
+
+// ---------------------------------------------------------------------------------------
+// Date formatting
+// Dates are written straight into caller buffers: digits come two at a time from a
+// lookup table (as std::to_chars does) and nothing touches iostreams or the C locale.
+// A pattern is compiled once into a short list of steps and then applied to any number
+// of dates.
+// ---------------------------------------------------------------------------------------
+
+namespace detail {
+
+// "00" "01" ... "99"
+inline constexpr std::array<char, 200> DIGIT_PAIRS = [] {
+    std::array<char, 200> pairs{};
+    for (int i = 0; i < 100; ++i) {
+        pairs[2 * i] = static_cast<char>('0' + i / 10);
+        pairs[2 * i + 1] = static_cast<char>('0' + i % 10);
+    }
+    return pairs;
+}();
+
+// Write the two digits of 0..99
+constexpr char* appendTwoDigits(char* out, unsigned int value) {
+    return std::copy_n(&DIGIT_PAIRS[2 * value], 2, out);
+}
+
+// Write an unsigned value using at least `minDigits` digits (zero padded)
+constexpr char* appendUnsigned(char* out, unsigned int value, int minDigits) {
+    char digits[12] = {};
+    char* p = digits + sizeof(digits);
+    while (value >= 100) {
+        p -= 2;
+        appendTwoDigits(p, value % 100);
+        value /= 100;
+    }
+    if (value >= 10) {
+        p -= 2;
+        appendTwoDigits(p, value);
+    } else {
+        *--p = static_cast<char>('0' + value);
+    }
+    while (digits + sizeof(digits) - p < minDigits) *--p = '0';
+    return std::copy(p, digits + sizeof(digits), out);
+}
+
+// Append a decimal integer to the output buffer
+constexpr char* appendInt(char* out, int value) {
+    unsigned int v = static_cast<unsigned int>(value);
+    if (value < 0) {
+        *out++ = '-';
+        v = 0u - v;
+    }
+    return appendUnsigned(out, v, 1);
+}
+
+} // namespace detail
+
+// A compiled output pattern. Conversion specifiers:
+//   %Y  year, at least 4 digits     %-Y  year without padding
+//   %m  month, 2 digits             %-m  month without padding
+//   %d  day, 2 digits               %-d  day without padding
+//   %j  day of the year, 3 digits
+//   %B  month name                  %b   first three letters of the month name
+//   %a  weekday name from weekdays[]
+//   %E  "Amete Mihret"              %K   year in the Amete Alem era (year + 5500)
+//   %k  "Amete Alem"                %%   a literal '%'
+// Ethiopian dates use months[], Gregorian dates gregorianMonths[]. An unknown specifier,
+// or a pattern longer than the fixed storage, leaves the pattern !valid(). The era
+// specifiers (%E, %K, %k) make a pattern ethiopianOnly(): it writes nothing for a Gregorian
+// date rather than put a Gregorian year in an Ethiopian era.
+class DatePattern {
+public:
+    static constexpr size_t MAX_STEPS = 32;
+    static constexpr size_t MAX_LITERAL = 64;
+
+    constexpr explicit DatePattern(std::string_view pattern) {
+        for (size_t i = 0; i < pattern.size(); ++i) {
+            if (pattern[i] != '%') {
+                addLiteral(pattern[i]);
+                continue;
+            }
+            bool unpadded = i + 1 < pattern.size() && pattern[i + 1] == '-';
+            if (unpadded) ++i;
+            if (++i == pattern.size()) {
+                valid_ = false;
+                break;
+            }
+            switch (pattern[i]) {
+                case '%': if (!unpadded) { addLiteral('%'); continue; } valid_ = false; break;
+                case 'Y': addStep(unpadded ? Kind::YearUnpadded : Kind::Year, 11); break;
+                case 'm': addStep(unpadded ? Kind::MonthUnpadded : Kind::Month, 2); break;
+                case 'd': addStep(unpadded ? Kind::DayUnpadded : Kind::Day, 2); break;
+                case 'j': addStep(Kind::DayOfYear, 3); needsJdn_ = true; break;
+                case 'B': addStep(Kind::MonthName, 9); break;
+                case 'b': addStep(Kind::MonthAbbreviation, 3); break;
+                case 'a': addStep(Kind::Weekday, 3); needsJdn_ = true; break;
+                case 'E': addStep(Kind::AmeteMihret, 12); ethiopianOnly_ = true; break;
+                case 'K': addStep(Kind::AmeteAlemYear, 11); ethiopianOnly_ = true; break;
+                case 'k': addStep(Kind::AmeteAlem, 10); ethiopianOnly_ = true; break;
+                default: valid_ = false; break;
+            }
+            if (unpadded && pattern[i] != 'Y' && pattern[i] != 'm' && pattern[i] != 'd') valid_ = false;
+        }
+
+        // "%Y<c>%m<c>%d" (ISO and friends) gets a straight-line path in format()
+        numericTriple_ = valid_ && stepCount_ == 5 && steps_[0].kind == Kind::Year && steps_[2].kind == Kind::Month &&
+                         steps_[4].kind == Kind::Day && steps_[1].length == 1 && steps_[3].length == 1;
+    }
+
+    constexpr bool valid() const {
+        return valid_;
+    }
+
+    // True when the pattern names an Ethiopian era and so only formats Ethiopian dates
+    constexpr bool ethiopianOnly() const {
+        return ethiopianOnly_;
+    }
+
+    // Upper bound on the characters written for any date; callers size buffers with it
+    constexpr size_t maxLength() const {
+        return maxLength_;
+    }
+
+    // Write an Ethiopian date at `out` (which must hold maxLength() characters);
+    // returns the end of the written text. Nothing is null-terminated.
+    constexpr char* format(char* out, const EthiopianDate& date) const {
+        if (numericTriple_ && static_cast<unsigned int>(date.year) < 10000) return formatTriple(out, date.year, date.month, date.day);
+        DayNumber jdn = needsJdn_ ? ethiopianToJdn(date.year, date.month, date.day) : 0;
+        int dayOfYear = 30 * (date.month - 1) + date.day;
+        return apply(out, date.year, date.month, date.day, dayOfYear, jdn, months);
+    }
+
+    // Writes nothing (returns `out`) when the pattern is ethiopianOnly()
+    constexpr char* format(char* out, const GregorianDate& date) const {
+        if (ethiopianOnly_) return out;
+        if (numericTriple_ && static_cast<unsigned int>(date.year) < 10000) return formatTriple(out, date.year, date.month, date.day);
+        DayNumber jdn = needsJdn_ ? gregorianToJdn(date.year, date.month, date.day) : 0;
+        int dayOfYear = needsJdn_ ? static_cast<int>(jdn - gregorianToJdn(date.year, 1, 1)) + 1 : 0;
+        return apply(out, date.year, date.month, date.day, dayOfYear, jdn, gregorianMonths);
+    }
+
+private:
+    enum class Kind : unsigned char {
+        Literal, Year, YearUnpadded, Month, MonthUnpadded, Day, DayUnpadded, DayOfYear,
+        MonthName, MonthAbbreviation, Weekday, AmeteMihret, AmeteAlemYear, AmeteAlem
+    };
+
+    struct Step {
+        Kind kind = Kind::Literal;
+        unsigned char offset = 0; // literal text in literals_
+        unsigned char length = 0;
+    };
+
+    constexpr void addStep(Kind kind, size_t width) {
+        if (stepCount_ == MAX_STEPS) {
+            valid_ = false;
+            return;
+        }
+        steps_[stepCount_++].kind = kind;
+        maxLength_ += width;
+    }
+
+    // Consecutive literal characters share one step
+    constexpr void addLiteral(char c) {
+        if (literalLength_ == MAX_LITERAL) {
+            valid_ = false;
+            return;
+        }
+        if (stepCount_ == 0 || steps_[stepCount_ - 1].kind != Kind::Literal) {
+            addStep(Kind::Literal, 0);
+            if (!valid_) return;
+            steps_[stepCount_ - 1].offset = static_cast<unsigned char>(literalLength_);
+        }
+        ++steps_[stepCount_ - 1].length;
+        literals_[literalLength_++] = c;
+        ++maxLength_;
+    }
+
+    static constexpr char* appendText(char* out, std::string_view text) {
+        return std::copy(text.begin(), text.end(), out);
+    }
+
+    static constexpr char* appendYear(char* out, int year, int minDigits) {
+        unsigned int v = static_cast<unsigned int>(year);
+        if (year < 0) {
+            *out++ = '-';
+            v = 0u - v;
+        }
+        // Four-digit years are by far the common case
+        if (minDigits == 4 && v < 10000) return detail::appendTwoDigits(detail::appendTwoDigits(out, v / 100), v % 100);
+        return detail::appendUnsigned(out, v, minDigits);
+    }
+
+    constexpr char* formatTriple(char* out, int year, int month, int day) const {
+        out = detail::appendTwoDigits(detail::appendTwoDigits(out, year / 100), year % 100);
+        *out++ = literals_[steps_[1].offset];
+        out = detail::appendTwoDigits(out, month);
+        *out++ = literals_[steps_[3].offset];
+        return detail::appendTwoDigits(out, day);
+    }
+
+    constexpr char* apply(char* out, int year, int month, int day, int dayOfYear, DayNumber jdn,
+                const std::string_view* monthNames) const {
+        for (size_t i = 0; i < stepCount_; ++i) {
+            const Step& step = steps_[i];
+            switch (step.kind) {
+                case Kind::Literal:
+                    // Separators are a character or two; a byte loop beats a memcpy call
+                    for (unsigned char k = 0; k < step.length; ++k) *out++ = literals_[step.offset + k];
+                    break;
+                case Kind::Year: out = appendYear(out, year, 4); break;
+                case Kind::YearUnpadded: out = appendYear(out, year, 1); break;
+                case Kind::Month: out = detail::appendTwoDigits(out, month); break;
+                case Kind::MonthUnpadded: out = detail::appendUnsigned(out, month, 1); break;
+                case Kind::Day: out = detail::appendTwoDigits(out, day); break;
+                case Kind::DayUnpadded: out = detail::appendUnsigned(out, day, 1); break;
+                case Kind::DayOfYear: out = detail::appendUnsigned(out, dayOfYear, 3); break;
+                case Kind::MonthName: out = appendText(out, monthNames[month - 1]); break;
+                case Kind::MonthAbbreviation: out = appendText(out, monthNames[month - 1].substr(0, 3)); break;
+                case Kind::Weekday: out = appendText(out, weekdays[weekdayFromJdn(jdn)]); break;
+                case Kind::AmeteMihret: out = appendText(out, "Amete Mihret"); break;
+                case Kind::AmeteAlemYear: out = appendYear(out, computeAmeteAlem(year), 1); break;
+                case Kind::AmeteAlem: out = appendText(out, "Amete Alem"); break;
+            }
+        }
+        return out;
+    }
+
+    Step steps_[MAX_STEPS] = {};
+    char literals_[MAX_LITERAL] = {};
+    size_t stepCount_ = 0;
+    size_t literalLength_ = 0;
+    size_t maxLength_ = 0;
+    bool valid_ = true;
+    bool needsJdn_ = false;
+    bool ethiopianOnly_ = false;
+    bool numericTriple_ = false;
+};
+
+inline constexpr DatePattern ISO_DATE_PATTERN("%Y-%m-%d");
+
+static_assert(ISO_DATE_PATTERN.valid() && ISO_DATE_PATTERN.maxLength() == 17, "%Y-%m-%d compiles");
+static_assert(!DatePattern("%Q").valid() && !DatePattern("%-B").valid(), "unknown specifiers are rejected");
+static_assert([] {
+    constexpr DatePattern eras("%-d %B %Y %E, %K %k");
+    char text[eras.maxLength()] = {};
+    std::string_view ethiopian(text, eras.format(text, EthiopianDate{2017, 1, 1}) - text);
+    return ethiopian == "1 Meskerem 2017 Amete Mihret, 7517 Amete Alem";
+}(), "era specifiers format Ethiopian dates");
+static_assert([] {
+    constexpr DatePattern ameteAlemYear("%Y %K");
+    char text[ameteAlemYear.maxLength()] = {};
+    return ameteAlemYear.ethiopianOnly() && ameteAlemYear.format(text, GregorianDate{2024, 9, 11}) == text &&
+           !ISO_DATE_PATTERN.ethiopianOnly();
+}(), "a Gregorian date is never written in an Ethiopian era");
+
+// ---------------------------------------------------------------------------------------
+// Buffered rendering
+// Calendars are formatted into a preallocated RenderBuffer with hand-rolled digit formatting
+// and written out with a single write, instead of many small (and flushing) cout calls.
+// ---------------------------------------------------------------------------------------
+
+// Fixed-capacity text buffer used by the renderers; text past the capacity is dropped
+// and `overflow` is set. A whole Ethiopian or Gregorian year fits with room to spare.
+struct RenderBuffer {
+    static constexpr size_t CAPACITY = 32 * 1024;
+
+    char data[CAPACITY];
+    size_t length = 0;
+    bool overflow = false;
+
+    void clear() {
+        length = 0;
+        overflow = false;
+    }
+
+    void append(std::string_view text) {
+        size_t n = text.size();
+        if (n > CAPACITY - length) {
+            n = CAPACITY - length;
+            overflow = true;
+        }
+        std::memcpy(data + length, text.data(), n);
+        length += n;
+    }
+
+    void append(char c) {
+        if (length == CAPACITY) {
+            overflow = true;
+            return;
+        }
+        data[length++] = c;
+    }
+
+    void appendInt(int value) {
+        char digits[12];
+        append(std::string_view(digits, detail::appendInt(digits, value) - digits));
+    }
+
+    // Right-align a non-negative value in `width` columns, like setw(width)
+    void appendPadded(int value, int width) {
+        char digits[12];
+        int n = static_cast<int>(detail::appendInt(digits, value) - digits);
+        for (int i = n; i < width; ++i) append(' ');
+        append(std::string_view(digits, n));
+    }
+
+    std::string_view view() const {
+        return std::string_view(data, length);
+    }
+};
+
+// A month grid depends only on the column of its first day and its length, so the day rows
+// of every layout (30 days or 5 / 6 for Pagume, 28..31 for Gregorian months) are rendered at
+// compile time. Both calendars use the same 4-character cells; only the column order differs
+// (Ethiopian weeks start on Monday, Gregorian ones on Sunday). Rendering a month copies its
+// template and then patches the holiday cells: a marked day "dd* " is the same width as a
+// plain one " dd ", so the patch never moves the rest of the grid.
+struct MonthGridTemplate {
+    char text[160];
+    unsigned char length;
+    unsigned char cellOffset[32]; // start of day d's 4-character cell
+};
+
+constexpr MonthGridTemplate buildMonthGridTemplate(int startColumn, int numDays) {
+    MonthGridTemplate t{};
+    size_t n = 0;
+
+    // Blank cells before the first day of the month
+    for (int column = 0; column < startColumn; ++column) {
+        for (int k = 0; k < 4; ++k) t.text[n++] = ' ';
+    }
+
+    int column = startColumn;
+    for (int day = 1; day <= numDays; ++day) {
+        t.cellOffset[day] = static_cast<unsigned char>(n);
+        t.text[n++] = ' ';
+        t.text[n++] = day >= 10 ? static_cast<char>('0' + day / 10) : ' ';
+        t.text[n++] = static_cast<char>('0' + day % 10);
+        t.text[n++] = ' ';
+        if (++column == 7) {
+            t.text[n++] = '\n';
+            column = 0;
+        }
+    }
+    t.text[n++] = '\n';
+    t.length = static_cast<unsigned char>(n);
+    return t;
+}
+
+// Month lengths with a template, in MONTH_GRID_TEMPLATES order
+inline constexpr int MONTH_GRID_LENGTHS[6] = {30, 5, 6, 28, 29, 31};
+
+// Indexed by [startColumn][position of the month length in MONTH_GRID_LENGTHS]
+inline constexpr auto MONTH_GRID_TEMPLATES = [] {
+    std::array<std::array<MonthGridTemplate, 6>, 7> templates{};
+    for (int startColumn = 0; startColumn < 7; ++startColumn) {
+        for (int k = 0; k < 6; ++k) templates[startColumn][k] = buildMonthGridTemplate(startColumn, MONTH_GRID_LENGTHS[k]);
+    }
+    return templates;
+}();
+
+inline const MonthGridTemplate& monthGridTemplate(int startColumn, int numDays) {
+    switch (numDays) {
+    case 30: return MONTH_GRID_TEMPLATES[startColumn][0];
+    case 5: return MONTH_GRID_TEMPLATES[startColumn][1];
+    case 6: return MONTH_GRID_TEMPLATES[startColumn][2];
+    case 28: return MONTH_GRID_TEMPLATES[startColumn][3];
+    case 29: return MONTH_GRID_TEMPLATES[startColumn][4];
+    default:
+        assert(numDays == 31);
+        return MONTH_GRID_TEMPLATES[startColumn][5];
+    }
+}
+
+// Render a calendar grid for a given Ethiopian month
+inline void renderMonthGrid(RenderBuffer& out, std::string_view monthName, int startDay, int numDays, int year, int monthIndex) {
+    out.append('\n');
+    out.append(monthName);
+    out.append(' ');
+    out.appendInt(year);
+    out.append("\nMon Tue Wed Thu Fri Sat Sun\n");
+
+    // Copy the day rows, then mark holidays with '*': " dd " becomes "dd* "
+    const MonthGridTemplate& grid = monthGridTemplate(startDay, numDays);
+    size_t base = out.length;
+    out.append(std::string_view(grid.text, grid.length));
+    unsigned int holidayMask = ethiopianHolidayMask(year, monthIndex);
+    for (unsigned int marks = holidayMask; marks != 0; marks &= marks - 1) {
+        int day = std::countr_zero(marks);
+        size_t cell = base + grid.cellOffset[day];
+        if (day > numDays || cell + 4 > out.length) continue; // clipped by a full buffer
+        out.data[cell] = out.data[cell + 1];
+        out.data[cell + 1] = out.data[cell + 2];
+        out.data[cell + 2] = '*';
+    }
+
+    // If there were holidays, list them below the calendar
+    if (holidayMask != 0) {
+        out.append("Holidays this month:\n");
+        for (int d = 1; d <= numDays; d++) {
+            if (holidayMask & (1u << d)) {
+                // A movable feast can share its day with a fixed holiday; list both
+                EthiopianHolidays holidays = getEthiopianHolidays(year, monthIndex, d);
+                for (HolidayId id : {holidays.fixed, holidays.movable}) {
+                    if (id == HolidayId::None) continue;
+                    out.appendInt(d);
+                    out.append(" - ");
+                    out.append(holidayName(id));
+                    out.append('\n');
+                }
+            }
+        }
+    }
+}
+
+// Render the full Ethiopian calendar for a given year
+inline void renderEthiopianYear(RenderBuffer& out, int year) {
+    int amete_alem = computeAmeteAlem(year);
+    EthiopianYearInfo info = ethiopianYearInfo(year);
+    int startDay = info.startWeekday; // Starting weekday for Meskerem
+
+    out.append("\nYear: ");
+    out.appendInt(year);
+    out.append("\nAmete Alem: ");
+    out.appendInt(amete_alem);
+    out.append("\nEvangelist: ");
+    out.append(getEvangelist(amete_alem));
+    out.append("\nFirst day of Meskerem: ");
+    out.append(weekdays[startDay]);
+    out.append('\n');
+
+    // Loop through all 13 months
+    for (int i = 0; i < 13; ++i) {
+        int daysInMonth = ethiopianDaysInMonth(year, i + 1);
+        renderMonthGrid(out, months[i], startDay, daysInMonth, year, i + 1);
+        startDay = (startDay + daysInMonth) % 7;
+    }
+}
+
+// Render one Ethiopian month (1..13) with its own header line, as it appears in the year view
+inline void renderEthiopianMonth(RenderBuffer& out, int year, int month) {
+    int startDay = (ethiopianYearInfo(year).startWeekday + 30 * (month - 1)) % 7;
+    renderMonthGrid(out, months[month - 1], startDay, ethiopianDaysInMonth(year, month), year, month);
+}
+
+// Render one Gregorian month (1..12)
+inline void renderGregorianMonth(RenderBuffer& out, int year, int month) {
+    out.append("\n  ");
+    out.append(gregorianMonths[month - 1]);
+    out.append(' ');
+    out.appendInt(year);
+    out.append("\nSun Mon Tue Wed Thu Fri Sat\n");
+
+    // JDN weekdays count from Monday; shift by one so that column 0 is Sunday
+    int startColumn = (weekdayFromJdn(gregorianToJdn(year, month, 1)) + 1) % 7;
+    const MonthGridTemplate& grid = monthGridTemplate(startColumn, gregorianDaysInMonth(year, month));
+    out.append(std::string_view(grid.text, grid.length));
+}
+
+// Render the Gregorian calendar for the whole year
+inline void renderGregorianYear(RenderBuffer& out, int year) {
+    out.append("\nGregorian Calendar for ");
+    out.appendInt(year);
+    out.append('\n');
+
+    for (int month = 1; month <= 12; ++month) renderGregorianMonth(out, year, month);
+}
+
+} // namespace ethiocal
+
+#endif // ETHIOPIAN_CALENDAR_H
@@ -0,0 +1,280 @@
+/*
+==========================================================================================
+
+Program Title: Ethiopian Calendar Benchmarks
+
+Purpose:
+---------
+Times the calendar core and the command-line front end's batch converter and render cache.
+Build and run it with:
+
+    g++ -std=c++20 -O2 -pthread ethiopian_calendar_bench.cpp -o ethiocal-bench
+    ./ethiocal-bench [--json]
+
+It compiles "Ethiopian Calendar.cpp" with that program's main() left out, so it measures
+exactly the code the CLI runs, while the allocation-counting operator new stays out of
+the CLI and server binaries.
+
+==========================================================================================
+*/
+
+#define ETHIOCAL_NO_MAIN
+#include "Ethiopian Calendar.cpp"
+
+#include <new>
+
+// ---------------------------------------------------------------------------------------
+// Benchmarks
+// Times the conversion core, holiday lookup, new-year computation and full-year rendering.
+// Every benchmark reports ns/op, ops/sec and heap allocations per op; allocations are
+// counted by the global operator new below, which only this program replaces.
+// ---------------------------------------------------------------------------------------
+
+atomic<uint64_t> heapAllocationCount{0};
+
+// Kept out of line: once inlined, GCC pairs malloc()/free() with the replaced operators and warns
+#if defined(__GNUC__)
+#define ETHIOCAL_NOINLINE __attribute__((noinline))
+#else
+#define ETHIOCAL_NOINLINE
+#endif
+
+ETHIOCAL_NOINLINE void* operator new(size_t size) {
+    heapAllocationCount.fetch_add(1, memory_order_relaxed);
+    if (void* p = malloc(size == 0 ? 1 : size)) return p;
+    throw bad_alloc();
+}
+
+ETHIOCAL_NOINLINE void operator delete(void* p) noexcept {
+    free(p);
+}
+
+ETHIOCAL_NOINLINE void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+
+struct BenchResult {
+    const char* name;
+    uint64_t ops;
+    double nsPerOp;
+    double opsPerSec;
+    double allocsPerOp;
+};
+
+// Results are folded into this so the optimiser cannot drop the measured work
+volatile uint64_t benchSink = 0;
+
+// Time `body` (which performs `opsPerCall` operations) for at least ~200 ms
+template <typename Body>
+BenchResult runBenchmark(const char* name, size_t opsPerCall, Body&& body) {
+    using Clock = chrono::steady_clock;
+    body(); // warm-up
+
+    uint64_t calls = 1;
+    while (true) {
+        uint64_t allocationsBefore = heapAllocationCount.load(memory_order_relaxed);
+        Clock::time_point start = Clock::now();
+        for (uint64_t i = 0; i < calls; ++i) body();
+        double ns = chrono::duration<double, nano>(Clock::now() - start).count();
+        uint64_t allocations = heapAllocationCount.load(memory_order_relaxed) - allocationsBefore;
+
+        if (ns >= 2e8 || calls >= (1ull << 40)) {
+            uint64_t ops = calls * opsPerCall;
+            return BenchResult{name, ops, ns / ops, ops * 1e9 / ns, static_cast<double>(allocations) / ops};
+        }
+        calls *= 2;
+    }
+}
+
+int runBenchmarks(bool json) {
+    // Deterministic pseudo-random inputs spread over 1900..2100
+    const size_t N = 4096;
+    vector<GregorianDate> gregorian(N);
+    vector<EthiopianDate> ethiopian(N);
+    vector<int> jdns(N);
+    vector<string> lines(N);
+    vector<string> isoLines(N);
+    vector<string> monthNameLines(N);
+    uint32_t seed = 12345;
+    for (size_t i = 0; i < N; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        jdns[i] = static_cast<int>(gregorianToJdn(1900, 1, 1) + seed % 73000);
+        gregorian[i] = jdnToGregorian(jdns[i]);
+        ethiopian[i] = jdnToEthiopian(jdns[i]);
+        char text[32];
+        char* end = appendInt(text, gregorian[i].year);
+        *end++ = '-';
+        end = appendInt(end, gregorian[i].month);
+        *end++ = '-';
+        end = appendInt(end, gregorian[i].day);
+        lines[i].assign(text, end);
+        char iso[32];
+        snprintf(iso, sizeof(iso), "%04d-%02d-%02d", gregorian[i].year, gregorian[i].month, gregorian[i].day);
+        isoLines[i] = iso;
+        monthNameLines[i] = string(months[ethiopian[i].month - 1]) + " " + to_string(ethiopian[i].day) + " " +
+                            to_string(ethiopian[i].year);
+    }
+    vector<string_view> isoRows(isoLines.begin(), isoLines.end());
+    vector<string_view> monthNameRows(monthNameLines.begin(), monthNameLines.end());
+    vector<ParsedDate> parsed(N);
+    vector<int64_t> timestamps(N);
+    for (size_t i = 0; i < N; ++i) timestamps[i] = (jdns[i] - UNIX_EPOCH_JDN) * 86400 + static_cast<int64_t>(i * 7919 % 86400);
+    vector<EthiopianDateTime> dateTimes(N);
+    vector<EthiopianDate> ethiopianOut(N);
+    vector<GregorianDate> gregorianOut(N);
+    static RenderBuffer buffer;
+
+    vector<BenchResult> results;
+    results.push_back(runBenchmark("gregorian_to_ethiopian", N, [&] {
+        uint64_t sum = 0;
+        for (const GregorianDate& g : gregorian) {
+            if (isValidGregorianDate(g.year, g.month, g.day)) sum += jdnToEthiopian(gregorianToJdn(g.year, g.month, g.day)).day;
+        }
+        benchSink = benchSink + sum;
+    }));
+    results.push_back(runBenchmark("ethiopian_to_gregorian", N, [&] {
+        uint64_t sum = 0;
+        for (const EthiopianDate& e : ethiopian) {
+            if (isValidEthiopianDate(e.year, e.month, e.day)) sum += jdnToGregorian(ethiopianToJdn(e.year, e.month, e.day)).day;
+        }
+        benchSink = benchSink + sum;
+    }));
+    results.push_back(runBenchmark("batch_gregorian_to_ethiopian", N, [&] {
+        benchSink = benchSink + convertGregorianToEthiopian(span<const GregorianDate>(gregorian), span<EthiopianDate>(ethiopianOut));
+    }));
+    results.push_back(runBenchmark("batch_ethiopian_to_gregorian", N, [&] {
+        benchSink = benchSink + convertEthiopianToGregorian(span<const EthiopianDate>(ethiopian), span<GregorianDate>(gregorianOut));
+    }));
+    results.push_back(runBenchmark("jdn_to_ethiopian_bulk", N, [&] {
+        jdnToEthiopian(span<const int>(jdns), span<EthiopianDate>(ethiopianOut));
+        benchSink = benchSink + ethiopianOut[N - 1].day;
+    }));
+    results.push_back(runBenchmark("jdn_to_gregorian_bulk", N, [&] {
+        jdnToGregorian(span<const int>(jdns), span<GregorianDate>(gregorianOut));
+        benchSink = benchSink + gregorianOut[N - 1].day;
+    }));
+    const DayNumber scanFirst = gregorianToJdn(1900, 1, 1);
+    results.push_back(runBenchmark("day_range_scan", N, [&] {
+        uint64_t sum = 0;
+        for (const CalendarDay& d : DayRange(scanFirst, scanFirst + N)) sum += d.ethiopian.day + d.gregorian.day;
+        benchSink = benchSink + sum;
+    }));
+    results.push_back(runBenchmark("day_scan_reconverting", N, [&] {
+        uint64_t sum = 0;
+        for (DayNumber jdn = scanFirst; jdn < scanFirst + static_cast<DayNumber>(N); ++jdn) {
+            sum += jdnToEthiopian(jdn).day + jdnToGregorian(jdn).day;
+        }
+        benchSink = benchSink + sum;
+    }));
+    results.push_back(runBenchmark("batch_line_gregorian_to_ethiopian", N, [&] {
+        char out[64];
+        uint64_t sum = 0;
+        for (const string& line : lines) {
+            sum += convertBatchLine(true, line.data(), line.data() + line.size(), out) - out;
+        }
+        benchSink = benchSink + sum;
+    }));
+    results.push_back(runBenchmark("epoch_seconds_to_ethiopian", N, [&] {
+        uint64_t sum = 0;
+        for (int64_t t : timestamps) {
+            EthiopianDateTime dt = epochSecondsToEthiopian(t, 3 * 3600);
+            sum += dt.date.day + dt.hour;
+        }
+        benchSink = benchSink + sum;
+    }));
+    results.push_back(runBenchmark("epoch_seconds_to_ethiopian_bulk", N, [&] {
+        epochSecondsToEthiopian(span<const int64_t>(timestamps), 3 * 3600, span<EthiopianDateTime>(dateTimes));
+        benchSink = benchSink + dateTimes[N - 1].date.day + dateTimes[N - 1].hour;
+    }));
+    results.push_back(runBenchmark("parse_iso_dates_scalar", N, [&] {
+        benchSink = benchSink + parseDates(span<const string_view>(isoRows), DateFormat::Iso, false, span<ParsedDate>(parsed),
+                                           SimdLevel::Scalar);
+    }));
+    results.push_back(runBenchmark("parse_iso_dates_bulk", N, [&] {
+        benchSink = benchSink + parseDates(span<const string_view>(isoRows), DateFormat::Iso, false, span<ParsedDate>(parsed));
+    }));
+    results.push_back(runBenchmark("parse_ethiopian_month_names", N, [&] {
+        benchSink = benchSink + parseDates(span<const string_view>(monthNameRows), DateFormat::EthiopianMonthName, true,
+                                           span<ParsedDate>(parsed));
+    }));
+    results.push_back(runBenchmark("format_iso_dates", N, [&] {
+        char text[32];
+        uint64_t sum = 0;
+        for (const EthiopianDate& e : ethiopian) sum += ISO_DATE_PATTERN.format(text, e) - text;
+        benchSink = benchSink + sum;
+    }));
+    results.push_back(runBenchmark("format_long_ethiopian_dates", N, [&] {
+        static constexpr DatePattern pattern("%a, %B %-d, %Y %E");
+        char text[pattern.maxLength()];
+        uint64_t sum = 0;
+        for (const EthiopianDate& e : ethiopian) sum += pattern.format(text, e) - text;
+        benchSink = benchSink + sum;
+    }));
+    results.push_back(runBenchmark("ethiopian_add_months", N, [&] {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < N; ++i) sum += addMonths(ethiopian[i], static_cast<int>(i % 40) - 20).day;
+        benchSink = benchSink + sum;
+    }));
+    results.push_back(runBenchmark("ethiopian_months_between", N, [&] {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < N; ++i) sum += monthsBetween(ethiopian[i], ethiopian[N - 1 - i]);
+        benchSink = benchSink + sum;
+    }));
+    results.push_back(runBenchmark("get_ethiopian_holiday", N, [&] {
+        uint64_t sum = 0;
+        for (const EthiopianDate& e : ethiopian) {
+            array<string_view, 2> names = getEthiopianHoliday(e.year, e.month, e.day);
+            sum += names[0].size() + names[1].size();
+        }
+        benchSink = benchSink + sum;
+    }));
+    results.push_back(runBenchmark("compute_new_year_start_day", N, [&] {
+        uint64_t sum = 0;
+        for (const EthiopianDate& e : ethiopian) sum += computeNewYearStartDay(e.year);
+        benchSink = benchSink + sum;
+    }));
+    int renderYear = 1900;
+    results.push_back(runBenchmark("render_ethiopian_year", 1, [&] {
+        buffer.clear();
+        renderEthiopianYear(buffer, 1900 + renderYear++ % 300);
+        benchSink = benchSink + buffer.length;
+    }));
+    results.push_back(runBenchmark("render_gregorian_year", 1, [&] {
+        buffer.clear();
+        renderGregorianYear(buffer, 1900 + renderYear++ % 300);
+        benchSink = benchSink + buffer.length;
+    }));
+    RenderCache cache(DEFAULT_RENDER_CACHE_BYTES);
+    results.push_back(runBenchmark("render_ethiopian_year_cached", 1, [&] {
+        shared_ptr<const string> text = cache.get(RenderKey{CalendarKind::Ethiopian, RenderFormat::Year, 2000 + renderYear++ % 16, 0});
+        memcpy(buffer.data, text->data(), text->size());
+        benchSink = benchSink + text->size();
+    }));
+
+    if (json) {
+        printf("{\n  \"simd\": \"%s\",\n  \"benchmarks\": [\n", simdLevelName(detectSimdLevel()));
+        for (size_t i = 0; i < results.size(); ++i) {
+            const BenchResult& r = results[i];
+            printf("    {\"name\": \"%s\", \"ops\": %llu, \"ns_per_op\": %.3f, \"ops_per_sec\": %.0f, \"allocs_per_op\": %.4f}%s\n",
+                   r.name, static_cast<unsigned long long>(r.ops), r.nsPerOp, r.opsPerSec, r.allocsPerOp,
+                   i + 1 < results.size() ? "," : "");
+        }
+        printf("  ]\n}\n");
+    } else {
+        printf("SIMD level: %s\n", simdLevelName(detectSimdLevel()));
+        printf("%-36s %12s %16s %12s\n", "benchmark", "ns/op", "ops/sec", "allocs/op");
+        for (const BenchResult& r : results) {
+            printf("%-36s %12.3f %16.0f %12.4f\n", r.name, r.nsPerOp, r.opsPerSec, r.allocsPerOp);
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    bool json = argc >= 2 && string(argv[1]) == "--json";
+    if (argc > 2 || (argc == 2 && !json)) {
+        fprintf(stderr, "Usage: %s [--json]\n", argv[0]);
+        return 1;
+    }
+    return runBenchmarks(json);
+}
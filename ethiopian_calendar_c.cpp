@@ -0,0 +1,165 @@
+// C ABI wrapper around ethiopian_calendar.h (see ethiopian_calendar_c.h for the build line)
+
+#define ETHIOCAL_BUILDING_LIBRARY
+#include "ethiopian_calendar_c.h"
+#include "ethiopian_calendar.h"
+
+#include <cstddef>
+#include <type_traits>
+
+using ethiocal::EthiopianDate;
+using ethiocal::EthiopianHolidays;
+using ethiocal::GregorianDate;
+using ethiocal::HolidayId;
+using ethiocal::convertEthiopianToGregorian;
+using ethiocal::convertGregorianToEthiopian;
+using ethiocal::ethiopianHolidayMask;
+using ethiocal::ethiopianToJdn;
+using ethiocal::getEthiopianHolidays;
+using ethiocal::gregorianToJdn;
+using ethiocal::holidayName;
+using ethiocal::isValidEthiopianDate;
+using ethiocal::isValidGregorianDate;
+using ethiocal::jdnToEthiopian;
+using ethiocal::jdnToGregorian;
+
+// ethiocal_date and the C++ date structs are distinct types, so batches are copied field by
+// field through small stack blocks rather than reinterpret_cast (which would break strict
+// aliasing). The layouts still match, which keeps those copies trivial.
+static_assert(sizeof(ethiocal_date) == sizeof(GregorianDate) && sizeof(ethiocal_date) == sizeof(EthiopianDate),
+              "ethiocal_date must match the C++ date structs");
+static_assert(std::is_standard_layout_v<GregorianDate> && std::is_standard_layout_v<EthiopianDate>,
+              "C++ date structs must be standard layout");
+static_assert(offsetof(ethiocal_date, month) == offsetof(GregorianDate, month) &&
+              offsetof(ethiocal_date, day) == offsetof(GregorianDate, day) &&
+              offsetof(ethiocal_date, month) == offsetof(EthiopianDate, month) &&
+              offsetof(ethiocal_date, day) == offsetof(EthiopianDate, day),
+              "ethiocal_date fields must line up with the C++ date structs");
+static_assert(std::is_same_v<int32_t, int>, "JDN columns are passed to the core as int");
+
+// Holiday ids are part of the ABI
+static_assert(static_cast<int>(HolidayId::None) == ETHIOCAL_HOLIDAY_NONE);
+static_assert(static_cast<int>(HolidayId::Enkutatash) == ETHIOCAL_HOLIDAY_ENKUTATASH);
+static_assert(static_cast<int>(HolidayId::Meskel) == ETHIOCAL_HOLIDAY_MESKEL);
+static_assert(static_cast<int>(HolidayId::Gena) == ETHIOCAL_HOLIDAY_GENA);
+static_assert(static_cast<int>(HolidayId::Timket) == ETHIOCAL_HOLIDAY_TIMKET);
+static_assert(static_cast<int>(HolidayId::Adwa) == ETHIOCAL_HOLIDAY_ADWA);
+static_assert(static_cast<int>(HolidayId::LabourDay) == ETHIOCAL_HOLIDAY_LABOUR_DAY);
+static_assert(static_cast<int>(HolidayId::PatriotsDay) == ETHIOCAL_HOLIDAY_PATRIOTS_DAY);
+static_assert(static_cast<int>(HolidayId::TsomeNenewe) == ETHIOCAL_HOLIDAY_TSOME_NENEWE);
+static_assert(static_cast<int>(HolidayId::AbiyTsom) == ETHIOCAL_HOLIDAY_ABIY_TSOM);
+static_assert(static_cast<int>(HolidayId::DebreZeit) == ETHIOCAL_HOLIDAY_DEBRE_ZEIT);
+static_assert(static_cast<int>(HolidayId::Hosanna) == ETHIOCAL_HOLIDAY_HOSANNA);
+static_assert(static_cast<int>(HolidayId::Siklet) == ETHIOCAL_HOLIDAY_SIKLET);
+static_assert(static_cast<int>(HolidayId::Fasika) == ETHIOCAL_HOLIDAY_FASIKA);
+static_assert(static_cast<int>(HolidayId::RikbeKahnat) == ETHIOCAL_HOLIDAY_RIKBE_KAHNAT);
+static_assert(static_cast<int>(HolidayId::Erget) == ETHIOCAL_HOLIDAY_ERGET);
+static_assert(static_cast<int>(HolidayId::Paraclete) == ETHIOCAL_HOLIDAY_PARACLETE);
+static_assert(static_cast<int>(HolidayId::TsomeHawariat) == ETHIOCAL_HOLIDAY_TSOME_HAWARIAT);
+static_assert(static_cast<int>(HolidayId::Count) == ETHIOCAL_HOLIDAY_COUNT);
+
+namespace {
+
+constexpr size_t BLOCK = 256;
+
+template <typename Date>
+ethiocal_date toC(const Date& date) {
+    return ethiocal_date{date.year, date.month, date.day};
+}
+
+template <typename Date>
+Date fromC(const ethiocal_date& date) {
+    return Date{date.year, date.month, date.day};
+}
+
+// Convert `count` dates through `convert(span<const From>, span<To>)` one stack block at a time
+template <typename From, typename To, typename Convert>
+size_t convertInBlocks(const ethiocal_date* in, ethiocal_date* out, size_t count, Convert convert) {
+    From from[BLOCK];
+    To to[BLOCK];
+    size_t invalid = 0;
+    for (size_t base = 0; base < count; base += BLOCK) {
+        size_t n = count - base < BLOCK ? count - base : BLOCK;
+        for (size_t i = 0; i < n; ++i) from[i] = fromC<From>(in[base + i]);
+        invalid += convert(std::span<const From>(from, n), std::span<To>(to, n));
+        for (size_t i = 0; i < n; ++i) out[base + i] = toC(to[i]);
+    }
+    return invalid;
+}
+
+// Same for a JDN column
+template <typename To, typename Convert>
+void convertJdnsInBlocks(const int32_t* jdns, ethiocal_date* out, size_t count, Convert convert) {
+    To to[BLOCK];
+    for (size_t base = 0; base < count; base += BLOCK) {
+        size_t n = count - base < BLOCK ? count - base : BLOCK;
+        convert(std::span<const int>(jdns + base, n), std::span<To>(to, n));
+        for (size_t i = 0; i < n; ++i) out[base + i] = toC(to[i]);
+    }
+}
+
+} // namespace
+
+extern "C" {
+
+int ethiocal_abi_version(void) {
+    return ETHIOCAL_ABI_VERSION;
+}
+
+int ethiocal_gregorian_to_ethiopian(int32_t year, int32_t month, int32_t day, ethiocal_date* out) {
+    if (!isValidGregorianDate(year, month, day)) return -1;
+    *out = toC(jdnToEthiopian(gregorianToJdn(year, month, day)));
+    return 0;
+}
+
+int ethiocal_ethiopian_to_gregorian(int32_t year, int32_t month, int32_t day, ethiocal_date* out) {
+    if (!isValidEthiopianDate(year, month, day)) return -1;
+    *out = toC(jdnToGregorian(ethiopianToJdn(year, month, day)));
+    return 0;
+}
+
+size_t ethiocal_gregorian_to_ethiopian_batch(const ethiocal_date* in, ethiocal_date* out, size_t count) {
+    return convertInBlocks<GregorianDate, EthiopianDate>(in, out, count, [](auto from, auto to) {
+        return convertGregorianToEthiopian(from, to);
+    });
+}
+
+size_t ethiocal_ethiopian_to_gregorian_batch(const ethiocal_date* in, ethiocal_date* out, size_t count) {
+    return convertInBlocks<EthiopianDate, GregorianDate>(in, out, count, [](auto from, auto to) {
+        return convertEthiopianToGregorian(from, to);
+    });
+}
+
+void ethiocal_jdn_to_ethiopian_batch(const int32_t* jdns, ethiocal_date* out, size_t count) {
+    convertJdnsInBlocks<EthiopianDate>(jdns, out, count, [](auto from, auto to) { jdnToEthiopian(from, to); });
+}
+
+void ethiocal_jdn_to_gregorian_batch(const int32_t* jdns, ethiocal_date* out, size_t count) {
+    convertJdnsInBlocks<GregorianDate>(jdns, out, count, [](auto from, auto to) { jdnToGregorian(from, to); });
+}
+
+int ethiocal_holiday_id(int32_t year, int32_t month, int32_t day) {
+    EthiopianHolidays holidays = getEthiopianHolidays(year, month, day);
+    return static_cast<int>(holidays.fixed != HolidayId::None ? holidays.fixed : holidays.movable);
+}
+
+int ethiocal_holiday_ids(int32_t year, int32_t month, int32_t day, int ids[2]) {
+    EthiopianHolidays holidays = getEthiopianHolidays(year, month, day);
+    int count = 0;
+    ids[0] = ids[1] = 0;
+    for (HolidayId id : {holidays.fixed, holidays.movable}) {
+        if (id != HolidayId::None) ids[count++] = static_cast<int>(id);
+    }
+    return count;
+}
+
+const char* ethiocal_holiday_name(int id) {
+    if (id < 0 || id >= static_cast<int>(HolidayId::Count)) return "";
+    return holidayName(static_cast<HolidayId>(id)).data(); // names are string literals
+}
+
+uint32_t ethiocal_holiday_mask(int32_t year, int32_t month) {
+    return ethiopianHolidayMask(year, month);
+}
+
+} // extern "C"
@@ -0,0 +1,106 @@
+/*
+==========================================================================================
+
+Library: Ethiopian Calendar C ABI
+
+Purpose:
+---------
+A plain C interface to ethiopian_calendar.h so the converter and holiday logic can be
+embedded through FFI from non-C++ services. Build it as a shared library with:
+
+    g++ -std=c++20 -O2 -shared -fPIC -fvisibility=hidden ethiopian_calendar_c.cpp -o libethiocal.so
+
+Conventions:
+--------------
+- Dates are passed as ethiocal_date {year, month, day}; months and days are 1-based and
+  Ethiopian month 13 is Pagume.
+- Single-date functions return 0 on success and -1 for an invalid input date.
+- Batch functions take raw pointers plus a length, never allocate, write invalid inputs as
+  {0, 0, 0} and return the number of invalid inputs.
+- Every function is reentrant and may be called from any number of threads.
+
+==========================================================================================
+*/
+
+#ifndef ETHIOPIAN_CALENDAR_C_H
+#define ETHIOPIAN_CALENDAR_C_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// The library's own build defines ETHIOCAL_BUILDING_LIBRARY; consumers import the symbols
+#if defined(_WIN32) && defined(ETHIOCAL_BUILDING_LIBRARY)
+#define ETHIOCAL_API __declspec(dllexport)
+#elif defined(_WIN32)
+#define ETHIOCAL_API __declspec(dllimport)
+#elif defined(__GNUC__)
+#define ETHIOCAL_API __attribute__((visibility("default")))
+#else
+#define ETHIOCAL_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Bumped whenever a signature or the layout of ethiocal_date changes
+#define ETHIOCAL_ABI_VERSION 1
+
+typedef struct ethiocal_date {
+    int32_t year;
+    int32_t month;
+    int32_t day;
+} ethiocal_date;
+
+ETHIOCAL_API int ethiocal_abi_version(void);
+
+// Single dates
+ETHIOCAL_API int ethiocal_gregorian_to_ethiopian(int32_t year, int32_t month, int32_t day, ethiocal_date* out);
+ETHIOCAL_API int ethiocal_ethiopian_to_gregorian(int32_t year, int32_t month, int32_t day, ethiocal_date* out);
+
+// Batches: `in` and `out` each hold `count` dates
+ETHIOCAL_API size_t ethiocal_gregorian_to_ethiopian_batch(const ethiocal_date* in, ethiocal_date* out, size_t count);
+ETHIOCAL_API size_t ethiocal_ethiopian_to_gregorian_batch(const ethiocal_date* in, ethiocal_date* out, size_t count);
+
+// Julian Day Number columns (SIMD accelerated where the CPU allows). Every JDN must be
+// within +-2000000000 (about years -5.48 million to +5.47 million).
+ETHIOCAL_API void ethiocal_jdn_to_ethiopian_batch(const int32_t* jdns, ethiocal_date* out, size_t count);
+ETHIOCAL_API void ethiocal_jdn_to_gregorian_batch(const int32_t* jdns, ethiocal_date* out, size_t count);
+
+// Holiday ids returned by ethiocal_holiday_id / ethiocal_holiday_ids. These values are part
+// of the ABI: new holidays are only ever appended.
+#define ETHIOCAL_HOLIDAY_NONE 0
+#define ETHIOCAL_HOLIDAY_ENKUTATASH 1
+#define ETHIOCAL_HOLIDAY_MESKEL 2
+#define ETHIOCAL_HOLIDAY_GENA 3
+#define ETHIOCAL_HOLIDAY_TIMKET 4
+#define ETHIOCAL_HOLIDAY_ADWA 5
+#define ETHIOCAL_HOLIDAY_LABOUR_DAY 6
+#define ETHIOCAL_HOLIDAY_PATRIOTS_DAY 7
+#define ETHIOCAL_HOLIDAY_TSOME_NENEWE 8
+#define ETHIOCAL_HOLIDAY_ABIY_TSOM 9
+#define ETHIOCAL_HOLIDAY_DEBRE_ZEIT 10
+#define ETHIOCAL_HOLIDAY_HOSANNA 11
+#define ETHIOCAL_HOLIDAY_SIKLET 12
+#define ETHIOCAL_HOLIDAY_FASIKA 13
+#define ETHIOCAL_HOLIDAY_RIKBE_KAHNAT 14
+#define ETHIOCAL_HOLIDAY_ERGET 15
+#define ETHIOCAL_HOLIDAY_PARACLETE 16
+#define ETHIOCAL_HOLIDAY_TSOME_HAWARIAT 17
+#define ETHIOCAL_HOLIDAY_COUNT 18
+
+// Holidays: 0 means no holiday. Names are static NUL-terminated strings ("" for 0).
+// A movable feast can fall on a fixed-date holiday (Fasika on Labour Day, for example):
+// ethiocal_holiday_id then returns the fixed-date one, while ethiocal_holiday_ids writes
+// both (fixed first, then movable; unused entries are 0) and returns how many there are.
+ETHIOCAL_API int ethiocal_holiday_id(int32_t year, int32_t month, int32_t day);
+ETHIOCAL_API int ethiocal_holiday_ids(int32_t year, int32_t month, int32_t day, int ids[2]);
+ETHIOCAL_API const char* ethiocal_holiday_name(int id);
+// Bit d is set when day d of the Ethiopian month is a holiday
+ETHIOCAL_API uint32_t ethiocal_holiday_mask(int32_t year, int32_t month);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ETHIOPIAN_CALENDAR_C_H